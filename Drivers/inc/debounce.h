@@ -0,0 +1,74 @@
+/*
+ * File:   debounce.h
+ * Author: jcrowley
+ *
+ * Bit parallel debouncer built on vertical counters. Every bit of a 16-bit input
+ * word has its own 4-bit counter stored across DEBOUNCE_PLANES words, so all the
+ * inputs are debounced together in a handful of word wide operations.
+ *
+ * A bit changes its debounced state once the raw sample has disagreed with it for
+ * its threshold number of samples in a row. The threshold is picked per bit and
+ * per direction (press = going to 1, release = going to 0), 1 to DEBOUNCE_MAX.
+ *
+ * The on fraction estimator keeps what the debouncer throws away: over the last
+ * ON_FRACTION_WINDOW raw samples of one input, how many were on. A comparator
+ * that only just trips fires now and then, one well inside its range fires on
+ * every sample.
+ *
+ */
+
+#ifndef _DEBOUNCE_H
+#define _DEBOUNCE_H
+
+#include <stdint.h>
+
+#define DEBOUNCE_PLANES 4
+#define DEBOUNCE_MAX ((1 << DEBOUNCE_PLANES) - 1)
+
+typedef struct {
+    uint16_t state; // debounced value of every bit
+    uint16_t count[DEBOUNCE_PLANES]; // bit plane k holds bit k of each counter
+    uint16_t press[DEBOUNCE_PLANES]; // threshold to go 0 -> 1, as bit planes
+    uint16_t release[DEBOUNCE_PLANES]; // threshold to go 1 -> 0, as bit planes
+} Debouncer_t;
+
+// Clears the counters and starts every bit at initialState with thresholds of 1.
+void debounceInit(Debouncer_t *db, uint16_t initialState);
+
+/*
+ * desc: sets the press and release thresholds (in samples) for every bit in bits.
+ * Values are clamped to 1..DEBOUNCE_MAX.
+ */
+void debounceSetThreshold(Debouncer_t *db, uint16_t bits, uint8_t pressSamples,
+        uint8_t releaseSamples);
+
+/*
+ * desc: runs one sample through the debouncer. Only bits set in sampleMask are
+ * looked at, the others keep their state and their counters untouched, which is
+ * how inputs that are only valid on some ticks (like a muxed line) are handled.
+ *
+ * ret: mask of the bits whose debounced state changed on this sample
+ */
+uint16_t debounceUpdate(Debouncer_t *db, uint16_t sample, uint16_t sampleMask);
+
+// returns the debounced state of every bit
+uint16_t debounceState(const Debouncer_t *db);
+
+#define ON_FRACTION_WINDOW 32
+#define ON_FRACTION_MAX 255
+
+typedef struct {
+    uint32_t history; // last ON_FRACTION_WINDOW samples, newest in bit 0
+    uint8_t count; // samples in history that were on
+} OnFraction_t;
+
+// Empties the window, the fraction starts at 0.
+void onFractionInit(OnFraction_t *of);
+
+// Shifts one raw sample (non zero is on) into the window.
+void onFractionUpdate(OnFraction_t *of, uint8_t sample);
+
+// returns the share of the window that was on, 0 to ON_FRACTION_MAX
+uint8_t onFractionGet(const OnFraction_t *of);
+
+#endif /* _DEBOUNCE_H */
@@ -0,0 +1,38 @@
+/*
+ * File:   encoder.h
+ * Author: jdgrant
+ *
+ * Quadrature encoder driver for the two drive wheels. Channel A of each encoder
+ * is on an input capture pin and interrupts on every edge, channel B is read in
+ * the ISR to get the direction. Counts are positive for forward on both wheels.
+ *
+ */
+
+#ifndef _ENCODER_H
+#define _ENCODER_H
+
+#include <stdint.h>
+
+#define ENCODER_LEFT 0
+#define ENCODER_RIGHT 1
+
+// Counts per wheel revolution, both edges of channel A (16 per motor rev x 30:1).
+// These three are the datasheet and CAD numbers, measure them on the robot (roll
+// a known distance, spin a known number of turns) before trusting the pose.
+#define ENCODER_COUNTS_PER_REV 480
+#define WHEEL_DIAMETER_MM 76
+// Distance between the contact patches of the two drive wheels
+#define WHEEL_BASE_MM 230
+// Wheel travel per count in micrometers, follows the two above
+#define ENCODER_UM_PER_COUNT ((WHEEL_DIAMETER_MM * 3142L) / ENCODER_COUNTS_PER_REV)
+
+// Sets up the channel B inputs and both input capture modules.
+void encoderInit();
+
+// returns the running count of the wheel (ENCODER_LEFT/ENCODER_RIGHT)
+int32_t encoderGetCount(uint8_t wheel);
+
+// zeroes both counts
+void encoderReset();
+
+#endif /* _ENCODER_H */
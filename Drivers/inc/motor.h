@@ -10,6 +10,8 @@
 #ifndef _MOTOR_H   
 #define _MOTOR_H
 
+#include <stdint.h>
+
 // Init function adds nessescary PWM/DIR pins for each motor, does not init pwm or IO.
 void motorInit(); 
 
@@ -64,5 +66,41 @@ void gradualTurnLeft(int difference);
 // positive offset to the left motor
 void gradualTurnRight(int difference);
 
+// Sets both wheel speeds (same units as setMotorSpeed, negative is backward).
+// If either is out of range both are scaled so the arc stays the same.
+void setArcSpeeds(int left, int right);
+
+/*
+ * Closed loop speed control from the wheel encoders. Each wheel tracks its
+ * target in mm/s (negative is backwards) with a PI loop that runs off Timer4 at
+ * 100 Hz. Any of the open loop functions above take the motors back.
+ */
+void setWheelVelocities(int16_t leftMmS, int16_t rightMmS);
+
+// returns the measured speed of a wheel (l/r) in mm/s, updated every tick and
+// averaged over the last 80 ms
+int16_t getWheelVelocity(int lr);
+
+// returns the duty (out of 1000, negative is backward) the tick last applied
+// to a wheel (l/r), battery compensation included
+int16_t getWheelDuty(int lr);
+
+/*
+ * Drives the robot at a forward speed v in mm/s and a turn rate omega in mrad/s
+ * (positive turns left) through the velocity loop. A twist the wheels can't
+ * reach is slowed down along the same arc rather than clipped per wheel.
+ */
+void setTwist(int16_t v, int16_t omega);
+
+/*
+ * All of the open loop functions above only set a target, the motor tick ramps
+ * the duty toward it and takes direction changes through zero. Rates are in duty
+ * counts (out of 1000) per second, jerk is how fast the ramp rate builds up.
+ */
+void setMotorProfile(uint16_t accel, uint16_t decel, uint16_t jerk);
+
+// returns TRUE once both wheels have ramped to their open loop targets, never
+// while the velocity loop has the motors
+uint8_t motorSettled();
 
 #endif /* _MOTOR_H */
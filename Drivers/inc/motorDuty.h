@@ -0,0 +1,30 @@
+/*
+ * File:   motorDuty.h
+ * Author: jdgrant
+ *
+ * Speed to PWM duty conversion for the drive motors. The battery compensated
+ * duty for every speed step is precomputed whenever the compensation factor
+ * changes, so a motor command is a clamp and a table lookup. Nothing in here
+ * touches the hardware, it also builds on the host for bench/motorDutyBench.c.
+ *
+ */
+
+#ifndef _MOTOR_DUTY_H
+#define _MOTOR_DUTY_H
+
+#include <stdint.h>
+
+// Speeds are duty cycle percent, clamped to 0..MOTOR_MAX_SPEED
+#define MOTOR_MAX_SPEED 50
+
+// Compensation is Q12 like getBatteryCompensation(), 1 << 12 is no correction
+#define MOTOR_DUTY_COMP_SHIFT 12
+
+// Rebuilds the duty table for a new Q12 compensation factor. Cheap to call with
+// an unchanged value, the table is only rebuilt when it differs.
+void motorDutySetCompensation(uint16_t compensation);
+
+// returns the PWM duty (0-1000) for speed after clamping and compensation
+uint16_t motorDutyFromSpeed(int speed);
+
+#endif /* _MOTOR_DUTY_H */
@@ -34,6 +34,20 @@
 #define FL_BUMPER PIN4
 #define B_BUMPER PIN5
 #define BUMPER_PORT PORTW
+#define BUMPER_PINS (FR_BUMPER|FL_BUMPER|B_BUMPER)
+// Change notification lines wired to the bumper pins (W3-W5 are RD4-RD6)
+#define BUMPER_CN_PINS (CN13_ENABLE|CN14_ENABLE|CN15_ENABLE)
+// and to the beacon detector (W8 is RD7)
+#define BEACON_CN_PIN CN16_ENABLE
+// The beacon output has to hold a new level this long before it counts
+#define BEACON_DWELL_US 1500
+
+// BEACON_TRIGGERED carries the new level in bit 0 and the low 15 bits of the ES
+// time (ms) of the edge above it, plenty for an event that is handled within a
+// few ms
+#define BEACON_EDGE_PARAM(seen, time) ((uint16_t)(((time) << 1) | ((seen) ? 1 : 0)))
+#define BEACON_EDGE_SEEN(param) ((param) & 1)
+#define BEACON_EDGE_TIME(param, now) ((now) - (((now) - ((param) >> 1)) & 0x7FFF))
 
 // Mux
 #define MUX_SELECT_A PIN11
@@ -50,6 +64,16 @@
 #define BRIDGE_OUT_PULSE 850
 #define RC_SERVO_BRIDGE RC_PORTY07
 
+/*
+ * One read of every digital input port, taken at the same time. The helpers
+ * below decode it so nothing else has to go back to the port registers.
+ */
+typedef struct {
+    uint16_t sensorPort; // SENSOR_PORT / BUMPER_PORT (PORTW)
+    uint16_t muxPort; // MUX_PORT (PORTZ), tells which track wire is selected
+    uint32_t time; // ES time (ms) the snapshot was taken
+} InputSnapshot_t;
+
 void sensorsInit(); 
 
 uint8_t readTrackWire();
@@ -71,7 +95,56 @@ uint8_t readBeaconDetector();
  * where the first two LSB are the front bumpers and 
  * next are the back bumpers
  */
-uint8_t readBumpSensors();
+uint8_t readBumpers();
+
+// Reads PORTW and PORTZ once each into snap and stamps it with the ES time.
+void readInputSnapshot(InputSnapshot_t *snap);
+
+// returns the bumpers in the snapshot in the same layout as readBumpers()
+uint8_t snapshotBumpers(const InputSnapshot_t *snap);
+
+// returns TRUE if the beacon detector output is active in the snapshot
+uint8_t snapshotBeacon(const InputSnapshot_t *snap);
+
+// returns TRUE if the selected track wire (see snapshotTrackWireSelect) is on
+uint8_t snapshotTrackWire(const InputSnapshot_t *snap);
+
+// returns the mux select the snapshot was taken with, 0 = front and 1 = back
+uint8_t snapshotTrackWireSelect(const InputSnapshot_t *snap);
+
+/*
+ * desc: returns the bumper pins (FR_BUMPER, FL_BUMPER, B_BUMPER) that were
+ * pressed since the last call. A press is reported by the change notification
+ * ISR on its first edge, the pin then stays latched until bumperEdgeRelease().
+ */
+uint16_t bumperEdgePending();
+
+/*
+ * desc: latches any of pins not already latched by the ISR and returns those,
+ * so a press the debouncer sees first is still only reported once.
+ */
+uint16_t bumperEdgeClaim(uint16_t pins);
+
+/*
+ * desc: re-arms the edge path for pins once their release has been debounced.
+ * Edges on a latched pin are ignored, which is what rejects the contact chatter.
+ */
+void bumperEdgeRelease(uint16_t pins);
+
+// returns the bumper pins whose edge path is latched, waiting on a release
+uint16_t bumperEdgeLatched();
+
+// returns the ES time (ms) of the most recent bumper press edge
+uint32_t getBumpTime();
+
+/*
+ * desc: returns TRUE once for every beacon change that has held for
+ * BEACON_DWELL_US, sets seen to the new level (1 = beacon seen) and time to the
+ * ES time (ms) of the change. The change notification ISR stamps every
+ * transition with the core timer, shorter pulses are chatter and never show up
+ * here.
+ */
+uint8_t beaconEdgePending(uint8_t *seen, uint32_t *time);
 
 void setPulseUnloadingServo(uint16_t pulse);
 
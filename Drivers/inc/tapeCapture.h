@@ -0,0 +1,62 @@
+/*
+ * File:   tapeCapture.h
+ * Author: TeamPutterWorth
+ *
+ * Hardware timed capture engine for the five TCRT5000 tape sensors. Timer5
+ * toggles the emitter LEDs and latches every channel a fixed settle time after
+ * each LED edge, so SyncSampling only has to pick up finished on/off frames.
+ *
+ */
+
+#ifndef _TAPE_CAPTURE_H
+#define _TAPE_CAPTURE_H
+
+#include <stdint.h>
+
+#define TAPE_NUM_SENSORS 5
+
+// Timer5 tick. Must be longer than one full AD scan so consecutive reads of a
+// channel are separate conversions.
+#define TAPE_TICK_US 100
+
+// Ticks the LEDs are held in a new state before the first conversion is used.
+// Covers the phototransistor rise time plus one AD scan after the edge.
+#define TAPE_SETTLE_TICKS 2
+
+// Each phase accumulates 2^TAPE_OVERSAMPLE_SHIFT conversions per channel after
+// the settle time (boxcar, decimated to one value per phase). With the defaults
+// a phase is 6 ticks, so one on/off pair takes 1.2 ms.
+#define TAPE_OVERSAMPLE_SHIFT 2
+#define TAPE_OVERSAMPLE (1 << TAPE_OVERSAMPLE_SHIFT)
+
+// Time between published frames, TapeFrame_t.sequence counts in these
+#define TAPE_FRAME_US (2 * (TAPE_SETTLE_TICKS + TAPE_OVERSAMPLE) * TAPE_TICK_US)
+
+/*
+ * One complete on/off capture. Index i matches bit i of the TAPE_TRIGGERED mask
+ * (TS_FR, TS_FL, TS_FM, TS_BR, TS_BL). on and off hold the sum of
+ * TAPE_OVERSAMPLE conversions, shift right by TAPE_OVERSAMPLE_SHIFT for counts.
+ */
+typedef struct {
+    uint16_t on[TAPE_NUM_SENSORS];
+    uint16_t off[TAPE_NUM_SENSORS];
+    uint16_t sequence; // increments once per published frame
+} TapeFrame_t;
+
+// Configures the LED outputs and AD pins, turns the LEDs on and starts Timer5.
+// Must be called after AD_Init().
+void tapeCaptureInit();
+
+/*
+ * desc: returns TRUE once for every frame published since the last call.
+ * Safe to call from an event checker.
+ */
+uint8_t tapeCaptureFrameReady();
+
+/*
+ * desc: copies the most recently completed frame into frame. The ISR only ever
+ * writes the back buffer, the copy is guarded against a buffer swap.
+ */
+void tapeCaptureReadFrame(TapeFrame_t *frame);
+
+#endif /* _TAPE_CAPTURE_H */
@@ -0,0 +1,41 @@
+/*
+ * File:   trackWireCapture.h
+ * Author: TeamPutterWorth
+ *
+ * Interrupt timed sampler for the two track wire detectors. They share one
+ * comparator output through the mux, so the Timer5 tick switches the mux, waits
+ * for the tank circuit to settle, reads the output and debounces both channels
+ * right there. The service side only picks up debounced changes.
+ *
+ */
+
+#ifndef _TRACK_WIRE_CAPTURE_H
+#define _TRACK_WIRE_CAPTURE_H
+
+#include <stdint.h>
+
+// Mux settle time after a switch. With the Timer5 tick at TAPE_TICK_US each
+// channel is read every 2 * TW_SETTLE_US.
+#define TW_SETTLE_US 500
+
+// Selects the front track wire and clears the debouncer, call after
+// sensorsInit() and before tapeCaptureInit() starts Timer5.
+void trackWireCaptureInit();
+
+// One Timer5 tick, called from the tape capture ISR.
+void trackWireCaptureTick();
+
+/*
+ * desc: returns TRUE once for every debounced change since the last call and
+ * sets state to the wires that are on (TW_F, TW_B). Safe to call from an event
+ * checker.
+ */
+uint8_t trackWireCaptureChanged(uint8_t *state);
+
+// returns the debounced wires that are on (TW_F, TW_B)
+uint8_t trackWireCaptureState();
+
+// returns the on fraction of a wire (0 front, 1 back), see onFractionGet()
+uint8_t trackWireCaptureStrength(uint8_t wire);
+
+#endif /* _TRACK_WIRE_CAPTURE_H */
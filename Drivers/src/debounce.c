@@ -0,0 +1,130 @@
+/*
+ * File:   debounce.c
+ * Author: jcrowley
+ *
+ * Bit parallel debouncer built on vertical counters. Every bit of a 16-bit input
+ * word has its own 4-bit counter stored across DEBOUNCE_PLANES words, so all the
+ * inputs are debounced together in a handful of word wide operations.
+ *
+ */
+
+#include <stdint.h>
+#include "debounce.h"
+
+void debounceInit(Debouncer_t *db, uint16_t initialState)
+{
+    int k;
+
+    db->state = initialState;
+    for (k = 0; k < DEBOUNCE_PLANES; k++)
+    {
+        db->count[k] = 0;
+        db->press[k] = 0;
+        db->release[k] = 0;
+    }
+    // threshold of 1 on every bit, only plane 0 is set
+    db->press[0] = 0xFFFF;
+    db->release[0] = 0xFFFF;
+}
+
+void debounceSetThreshold(Debouncer_t *db, uint16_t bits, uint8_t pressSamples,
+        uint8_t releaseSamples)
+{
+    int k;
+
+    if (pressSamples < 1) pressSamples = 1;
+    if (pressSamples > DEBOUNCE_MAX) pressSamples = DEBOUNCE_MAX;
+    if (releaseSamples < 1) releaseSamples = 1;
+    if (releaseSamples > DEBOUNCE_MAX) releaseSamples = DEBOUNCE_MAX;
+
+    // spread each threshold across the planes, bit k of the value into plane k
+    for (k = 0; k < DEBOUNCE_PLANES; k++)
+    {
+        if (pressSamples & (1 << k))
+        {
+            db->press[k] |= bits;
+        }
+        else
+        {
+            db->press[k] &= ~bits;
+        }
+        if (releaseSamples & (1 << k))
+        {
+            db->release[k] |= bits;
+        }
+        else
+        {
+            db->release[k] &= ~bits;
+        }
+    }
+}
+
+/*
+ * Counters only run while the raw sample disagrees with the debounced state, any
+ * agreeing sample clears them. When a counter reaches the threshold for the
+ * direction it would move in, the bit flips and its counter starts over.
+ */
+uint16_t debounceUpdate(Debouncer_t *db, uint16_t sample, uint16_t sampleMask)
+{
+    int k;
+    uint16_t diff = (sample ^ db->state) & sampleMask;
+    uint16_t carry = diff;
+    uint16_t carryOut;
+    uint16_t threshold;
+    uint16_t match = 0xFFFF;
+    uint16_t changed;
+
+    for (k = 0; k < DEBOUNCE_PLANES; k++)
+    {
+        // ripple a +1 through the disagreeing bits, clear the sampled agreeing ones
+        carryOut = db->count[k] & carry;
+        db->count[k] = ((db->count[k] ^ carry) & diff) | (db->count[k] & ~sampleMask);
+        carry = carryOut;
+
+        // released bits compare against press, pressed bits against release
+        threshold = (db->press[k] & ~db->state) | (db->release[k] & db->state);
+        match &= ~(db->count[k] ^ threshold);
+    }
+
+    changed = match & diff;
+    db->state ^= changed;
+    for (k = 0; k < DEBOUNCE_PLANES; k++)
+    {
+        db->count[k] &= ~changed;
+    }
+    return changed;
+}
+
+uint16_t debounceState(const Debouncer_t *db)
+{
+    return db->state;
+}
+
+void onFractionInit(OnFraction_t *of)
+{
+    of->history = 0;
+    of->count = 0;
+}
+
+/*
+ * The running count only changes by the sample coming in and the one falling
+ * off the end of the window, so there's no need to count bits.
+ */
+void onFractionUpdate(OnFraction_t *of, uint8_t sample)
+{
+    if (of->history & (1UL << (ON_FRACTION_WINDOW - 1)))
+    {
+        of->count--;
+    }
+    of->history <<= 1;
+    if (sample)
+    {
+        of->history |= 1;
+        of->count++;
+    }
+}
+
+uint8_t onFractionGet(const OnFraction_t *of)
+{
+    return ((uint16_t)of->count * ON_FRACTION_MAX) / ON_FRACTION_WINDOW;
+}
@@ -0,0 +1,92 @@
+/*
+ * File:   encoder.c
+ * Author: jdgrant
+ *
+ * Quadrature encoder driver for the two drive wheels. Channel A of each encoder
+ * is on an input capture pin and interrupts on every edge, channel B is read in
+ * the ISR to get the direction. Counts are positive for forward on both wheels.
+ *
+ */
+
+#include <xc.h>
+#include <plib.h>
+#include "BOARD.h"
+#include "IO_Ports.h"
+#include "encoder.h"
+
+// Channel A is IC1 (RD8) on the left wheel and IC2 (RD9) on the right, B is on
+// X3/X4. Check these against the harness if a wheel counts the wrong way or not
+// at all, the pose and every timed move depend on them.
+#define ENC_B_PORT PORTX
+#define ENC_LEFT_B PIN3
+#define ENC_RIGHT_B PIN4
+
+static volatile int32_t counts[2] = {0, 0};
+
+void encoderInit()
+{
+    IO_PortsSetPortInputs(ENC_B_PORT, ENC_LEFT_B | ENC_RIGHT_B);
+
+    // Only the interrupt is used, the captured timer value is thrown away
+    OpenCapture1(IC_ON | IC_EVERY_EDGE | IC_INT_1CAPTURE | IC_TIMER2_SRC | IC_CAP_16BIT);
+    OpenCapture2(IC_ON | IC_EVERY_EDGE | IC_INT_1CAPTURE | IC_TIMER2_SRC | IC_CAP_16BIT);
+    ConfigIntCapture1(IC_INT_ON | IC_INT_PRIOR_5);
+    ConfigIntCapture2(IC_INT_ON | IC_INT_PRIOR_5);
+}
+
+int32_t encoderGetCount(uint8_t wheel)
+{
+    return counts[wheel];
+}
+
+void encoderReset()
+{
+    counts[ENCODER_LEFT] = 0;
+    counts[ENCODER_RIGHT] = 0;
+}
+
+/*
+ * On an edge of A the wheel is going forward when A and B differ. The right
+ * wheel is mounted mirrored so its sense is flipped.
+ */
+void __ISR(_INPUT_CAPTURE_1_VECTOR, ipl5) IC1IntHandler(void)
+{
+    uint8_t a, b;
+
+    while (mIC1CaptureReady())
+    {
+        mIC1ReadCapture(); // drain the buffer or the interrupt keeps firing
+    }
+    mIC1ClearIntFlag();
+    a = PORTDbits.RD8;
+    b = (IO_PortsReadPort(ENC_B_PORT) & ENC_LEFT_B) ? 1 : 0;
+    if (a ^ b)
+    {
+        counts[ENCODER_LEFT]++;
+    }
+    else
+    {
+        counts[ENCODER_LEFT]--;
+    }
+}
+
+void __ISR(_INPUT_CAPTURE_2_VECTOR, ipl5) IC2IntHandler(void)
+{
+    uint8_t a, b;
+
+    while (mIC2CaptureReady())
+    {
+        mIC2ReadCapture();
+    }
+    mIC2ClearIntFlag();
+    a = PORTDbits.RD9;
+    b = (IO_PortsReadPort(ENC_B_PORT) & ENC_RIGHT_B) ? 1 : 0;
+    if (a ^ b)
+    {
+        counts[ENCODER_RIGHT]--;
+    }
+    else
+    {
+        counts[ENCODER_RIGHT]++;
+    }
+}
@@ -7,12 +7,16 @@
  * 
  */
 
+#include <xc.h>
+#include <plib.h>
 #include "BOARD.h"
 #include "IO_Ports.h"
 #include "LED.h"
 #include "pwm.h"
 #include "AD.h"
 #include "motor.h"
+#include "motorDuty.h"
+#include "encoder.h"
 #include <stdio.h>
 
 //#define DEBUG
@@ -23,69 +27,168 @@
 #define RIGHT 1
 #define LEFT 0
 #define NORM_SPEED 25
-#define MAX_VOLTAGE 9.9
+
+// Motor tick, runs the duty profiles and the velocity loop off Timer4
+#define MOTOR_TICK_HZ 100
+#define TIMER_4_PRESCALE 64
+#define MAX_DUTY 1000
+
+// Default duty profile in duty counts per second. Braking (toward zero, which
+// includes the first half of a reversal) is allowed to be quicker than speeding
+// up. Jerk is how fast the ramp rate itself builds up from rest.
+#define DEFAULT_ACCEL 4000
+#define DEFAULT_DECEL 8000
+#define DEFAULT_JERK 1000
+// Gains are Q8 in duty counts per mm/s. The feed forward gets the wheel close
+// to the target on its own, PI only has to trim out load and battery.
+#define VEL_KFF 320
+#define VEL_KP 384
+#define VEL_KI 64
+#define VEL_INTEGRAL_LIMIT ((MAX_DUTY / 2) * 256)
+#define VEL_ACCEL_STEP 8 // mm/s per tick, 800 mm/s^2 on the closed loop setpoint
+// Fastest wheel setpoint setTwist() will ask for, full duty is about 800 mm/s
+// with the feed forward gain and the PI needs some room on top
+#define MAX_WHEEL_VELOCITY 700
+// Wheel speed is the encoder travel over the last VEL_WINDOW ticks. One count in
+// a single tick is about 50 mm/s, which times VEL_KP would kick the duty by 75
+// every tick, over 8 ticks a count is about 6 mm/s. The speed lags by half the
+// window.
+#define VEL_WINDOW 8
+
+static volatile uint8_t velocityMode = FALSE;
+static volatile int16_t targetVelocity[2] = {0, 0};
+static int16_t commandVelocity[2] = {0, 0};
+static volatile int16_t measuredVelocity[2] = {0, 0};
+static int32_t velIntegral[2] = {0, 0};
+static int32_t countHistory[2][VEL_WINDOW]; // last VEL_WINDOW counts, oldest at historyIndex
+static uint8_t historyIndex = 0;
+
+// Open loop commands only set targets, the tick ramps the applied duty to them.
+// Duties are signed, positive is forward.
+static uint8_t wheelForward[2] = {TRUE, TRUE};
+static uint16_t wheelDuty[2] = {0, 0};
+static volatile int16_t targetDuty[2] = {0, 0};
+static int16_t appliedDuty[2] = {0, 0};
+static int16_t rampRate[2] = {0, 0};
+
+// Last command written to the hardware
+static uint16_t lastDirBits = 0;
+static uint16_t lastPwm[2] = {0, 0};
+static volatile int16_t accelStep = DEFAULT_ACCEL / MOTOR_TICK_HZ;
+static volatile int16_t decelStep = DEFAULT_DECEL / MOTOR_TICK_HZ;
+static volatile int16_t jerkStep = DEFAULT_JERK / MOTOR_TICK_HZ;
+
+static void updateTargetDuty(int lr);
+static void commandWheels(uint8_t leftForward, uint16_t leftDuty,
+        uint8_t rightForward, uint16_t rightDuty);
+static int16_t rampDuty(int lr);
+static int16_t rampVelocity(int lr);
+static void driveWheels(int32_t left, int32_t right);
 
 void motorInit()
 {
     IO_PortsSetPortOutputs(PORTY, DIR_LEFT_MOTOR|DIR_RIGHT_MOTOR);
     PWM_AddPins(PWM_LEFT_MOTOR|PWM_RIGHT_MOTOR);
+
+    // put the hardware in the state the command cache starts in
+    IO_PortsClearPortBits(PORTY, DIR_LEFT_MOTOR|DIR_RIGHT_MOTOR);
+    PWM_SetDutyCycle(PWM_LEFT_MOTOR, 0);
+    PWM_SetDutyCycle(PWM_RIGHT_MOTOR, 0);
+    lastDirBits = 0;
+
+    // The tick owns the motor outputs, it ramps the open loop duty or runs the
+    // velocity loop after setWheelVelocities()
+    OpenTimer4(T4_ON | T4_SOURCE_INT | T4_PS_1_64,
+            BOARD_GetPBClock() / TIMER_4_PRESCALE / MOTOR_TICK_HZ);
+    ConfigIntTimer4(T4_INT_ON | T4_INT_PRIOR_2);
+}
+
+void setWheelVelocities(int16_t leftMmS, int16_t rightMmS)
+{
+    if (!velocityMode)
+    {
+        // coming from open loop, start the PI and the setpoint ramp from
+        // where the wheels are now
+        velIntegral[LEFT] = 0;
+        velIntegral[RIGHT] = 0;
+        commandVelocity[LEFT] = measuredVelocity[LEFT];
+        commandVelocity[RIGHT] = measuredVelocity[RIGHT];
+    }
+    DisableIntT4;
+    targetVelocity[LEFT] = leftMmS;
+    targetVelocity[RIGHT] = rightMmS;
+    velocityMode = TRUE;
+    EnableIntT4;
+}
+
+int16_t getWheelVelocity(int lr)
+{
+    return measuredVelocity[lr];
+}
+
+int16_t getWheelDuty(int lr)
+{
+    return appliedDuty[lr];
+}
+
+void setMotorProfile(uint16_t accel, uint16_t decel, uint16_t jerk)
+{
+    accelStep = accel / MOTOR_TICK_HZ;
+    decelStep = decel / MOTOR_TICK_HZ;
+    jerkStep = jerk / MOTOR_TICK_HZ;
+    if (accelStep < 1) accelStep = 1;
+    if (decelStep < 1) decelStep = 1;
+    if (jerkStep < 1) jerkStep = 1;
+}
+
+uint8_t motorSettled()
+{
+    if (velocityMode)
+    {
+        return FALSE; // the loop drives appliedDuty, targetDuty is left over
+    }
+    return (appliedDuty[LEFT] == targetDuty[LEFT]) && (appliedDuty[RIGHT] == targetDuty[RIGHT]);
 }
 
 void pivotTurnRight()
 {
-	motorForward(RIGHT);
-    setMoveSpeed(NORM_SPEED);
-	motorStop(LEFT);
+    setArcSpeeds(0, NORM_SPEED);
 }
 
 void pivotTurnLeft()
 {
-	motorForward(LEFT);
-    setMoveSpeed(NORM_SPEED);
-	motorStop(RIGHT);
+    setArcSpeeds(NORM_SPEED, 0);
 }
 
 void pivotTurnRightBackward()
 {
-    motorStop(LEFT);
-	motorBackward(RIGHT);
-    setMotorSpeed(RIGHT, NORM_SPEED);
+    setArcSpeeds(0, -NORM_SPEED);
 }
 
 void pivotTurnLeftBackward()
 {
-    motorStop(RIGHT);
-	motorBackward(LEFT);
-    setMotorSpeed(LEFT, NORM_SPEED);
+    setArcSpeeds(-NORM_SPEED, 0);
 }
 
 
 void tankTurnRight()
 {
-	motorForward(LEFT);
-	motorBackward(RIGHT);
-    setMoveSpeed(NORM_SPEED);
+    setArcSpeeds(NORM_SPEED, -NORM_SPEED);
 }
 
 void tankTurnLeft()
 {
-	motorForward(RIGHT);
-	motorBackward(LEFT);
-    setMoveSpeed(NORM_SPEED);
+    setArcSpeeds(-NORM_SPEED, NORM_SPEED);
 }
 
 void moveBackward()
 {
-	motorBackward(RIGHT);
-	motorBackward(LEFT);
-    setMoveSpeed(NORM_SPEED);
+    setArcSpeeds(-NORM_SPEED, -NORM_SPEED);
 }
 
 void moveForward()
 {
-	motorForward(LEFT);
-	motorForward(RIGHT);
-    setMoveSpeed(NORM_SPEED);
+    setArcSpeeds(NORM_SPEED, NORM_SPEED);
 }
 
 void stopMoving()
@@ -93,20 +196,70 @@ void stopMoving()
 	setMoveSpeed(0);
 }
 
+/*
+ * The inner wheel stops at zero rather than running backward, so a big
+ * difference is a pivot on the inner wheel like it always was.
+ */
 void gradualTurnLeft(int difference)
 {
-    motorForward(LEFT);
-    motorForward(RIGHT);
-	setMotorSpeed(LEFT, NORM_SPEED - (difference/2));
-	setMotorSpeed(RIGHT, NORM_SPEED + (difference/2));
+    int inner = NORM_SPEED - (difference/2);
+
+    setArcSpeeds((inner < 0) ? 0 : inner, NORM_SPEED + (difference/2));
 }
 
 void gradualTurnRight(int difference)
 {
-    motorForward(LEFT);
-    motorForward(RIGHT);
-	setMotorSpeed(LEFT, NORM_SPEED + (difference/2));
-	setMotorSpeed(RIGHT, NORM_SPEED - (difference/2));
+    int inner = NORM_SPEED - (difference/2);
+
+    setArcSpeeds(NORM_SPEED + (difference/2), (inner < 0) ? 0 : inner);
+}
+
+/*
+ * Clipping each wheel on its own would change the arc, so if either side is out
+ * of range both are scaled down by the same factor. Negative runs backward.
+ */
+void setArcSpeeds(int left, int right)
+{
+    int peak = (left < 0) ? -left : left;
+    int rightMag = (right < 0) ? -right : right;
+
+    if (rightMag > peak)
+    {
+        peak = rightMag;
+    }
+    if (peak > MOTOR_MAX_SPEED)
+    {
+        left = (left * MOTOR_MAX_SPEED) / peak;
+        right = (right * MOTOR_MAX_SPEED) / peak;
+    }
+
+    commandWheels(left >= 0, motorDutyFromSpeed(left < 0 ? -left : left),
+            right >= 0, motorDutyFromSpeed(right < 0 ? -right : right));
+}
+
+/*
+ * Differential drive: each wheel runs at v -/+ omega * base / 2. When the faster
+ * wheel would be over MAX_WHEEL_VELOCITY both wheels are scaled down together,
+ * which keeps the radius (v / omega) and gives up speed instead.
+ */
+void setTwist(int16_t v, int16_t omega)
+{
+    int32_t turn = ((int32_t)omega * WHEEL_BASE_MM) / 2000;
+    int32_t left = v - turn;
+    int32_t right = v + turn;
+    int32_t peak = (left < 0) ? -left : left;
+    int32_t rightMag = (right < 0) ? -right : right;
+
+    if (rightMag > peak)
+    {
+        peak = rightMag;
+    }
+    if (peak > MAX_WHEEL_VELOCITY)
+    {
+        left = (left * MAX_WHEEL_VELOCITY) / peak;
+        right = (right * MAX_WHEEL_VELOCITY) / peak;
+    }
+    setWheelVelocities((int16_t)left, (int16_t)right);
 }
 
 /*
@@ -115,15 +268,9 @@ void gradualTurnRight(int difference)
 */
 void motorForward(int lr)
 {
-	// sets IN0 = 0, IN1 = 1
-	if (lr == RIGHT) 
-	{
-        IO_PortsWritePort(PORTY,IO_PortsReadPort(PORTY) | DIR_RIGHT_MOTOR); // Set Dir right motor = low (forward)
-	}
-	else
-	{   
-        IO_PortsWritePort(PORTY,IO_PortsReadPort(PORTY) & ~DIR_LEFT_MOTOR); // Set Dir left motor = high (forward)
-	}
+    velocityMode = FALSE; // open loop command, the velocity loop lets go
+    wheelForward[lr] = TRUE;
+    updateTargetDuty(lr);
 	return;
 }
 
@@ -133,79 +280,227 @@ void motorForward(int lr)
 */
 void motorBackward(int lr)
 {
-	// sets IN0 = 0, IN1 = 1
-	if (lr == RIGHT) 
-	{
-		IO_PortsWritePort(PORTY,IO_PortsReadPort(PORTY) & ~DIR_RIGHT_MOTOR); // Set Dir right motor = high (backward)
-	}
-	else
-	{
-		IO_PortsWritePort(PORTY,IO_PortsReadPort(PORTY) | DIR_LEFT_MOTOR); // Set Dir left motor = low (backward)
-	}
+    velocityMode = FALSE; // open loop command, the velocity loop lets go
+    wheelForward[lr] = FALSE;
+    updateTargetDuty(lr);
 	return;
 }
 
 void motorStop(int lr)
 {
-	if (lr == RIGHT) 
-	{
-		PWM_SetDutyCycle(PWM_RIGHT_MOTOR,0);
-	}
-	else
-	{
-		PWM_SetDutyCycle(PWM_LEFT_MOTOR,0);
-	}
+    velocityMode = FALSE; // open loop command, the velocity loop lets go
+    wheelDuty[lr] = 0;
+    updateTargetDuty(lr);
 	return;
 }
 
 void setMotorSpeed(int lr, int speed)
 {
-    uint16_t batVoltage = (AD_ReadADPin(BAT_VOLTAGE) * 33) / 1023; // read the battery voltage
-	if(speed > 50)
+    velocityMode = FALSE;
+    // clamped and battery compensated from the precomputed table
+    wheelDuty[lr] = motorDutyFromSpeed(speed);
+    updateTargetDuty(lr);
+	return;
+}
+
+/*
+ * Right now speed should be duty cycle 0-100
+ * For speeds in mm/s with encoder feedback use setWheelVelocities().
+ */
+void setMoveSpeed(int speed)
+{
+    uint16_t duty = motorDutyFromSpeed(speed);
+
+    velocityMode = FALSE;
+    commandWheels(wheelForward[LEFT], duty, wheelForward[RIGHT], duty);
+    return;
+}
+
+static void updateTargetDuty(int lr)
+{
+    targetDuty[lr] = wheelForward[lr] ? wheelDuty[lr] : -(int16_t)wheelDuty[lr];
+}
+
+/*
+ * Sets both open loop targets as one command, the tick is held off while they
+ * change so it never sees one wheel updated and the other not.
+ */
+static void commandWheels(uint8_t leftForward, uint16_t leftDuty,
+        uint8_t rightForward, uint16_t rightDuty)
+{
+    velocityMode = FALSE;
+    wheelForward[LEFT] = leftForward;
+    wheelForward[RIGHT] = rightForward;
+    wheelDuty[LEFT] = leftDuty;
+    wheelDuty[RIGHT] = rightDuty;
+    DisableIntT4;
+    updateTargetDuty(LEFT);
+    updateTargetDuty(RIGHT);
+    EnableIntT4;
+}
+
+/*
+ * One step of the trapezoid toward the target duty. Moving away from zero is
+ * limited by accelStep, moving toward zero by decelStep, and a reversal stops at
+ * zero for a tick before it speeds up the other way. The step itself grows by
+ * jerkStep each tick so the ramp doesn't start with a jolt.
+ */
+static int16_t rampDuty(int lr)
+{
+    int16_t cur = appliedDuty[lr];
+    int16_t target = targetDuty[lr];
+    int16_t limit;
+
+    if (cur == target)
     {
-        speed = 50;
+        rampRate[lr] = 0;
+        return cur;
     }
-    else if(speed < 0)
+
+    if ((cur >= 0 && target > cur) || (cur <= 0 && target < cur))
     {
-        speed = 0;
+        limit = accelStep;
     }
-    
-    speed = speed * 10; // Duty cycle is set in increments of 1/1000, rather than 1/100
-    speed = speed * MAX_VOLTAGE/batVoltage;
- 
-    if (lr == RIGHT) 
-	{
-		PWM_SetDutyCycle(PWM_RIGHT_MOTOR, speed);
-	}
-	else
-	{
-		PWM_SetDutyCycle(PWM_LEFT_MOTOR, speed);
-	}
-	return;
+    else
+    {
+        limit = decelStep;
+        if ((cur > 0 && target < 0) || (cur < 0 && target > 0))
+        {
+            target = 0; // brake through zero first
+        }
+    }
+    rampRate[lr] += jerkStep;
+    if (rampRate[lr] > limit)
+    {
+        rampRate[lr] = limit;
+    }
+
+    if (target > cur)
+    {
+        cur = (target - cur > rampRate[lr]) ? cur + rampRate[lr] : target;
+    }
+    else
+    {
+        cur = (cur - target > rampRate[lr]) ? cur - rampRate[lr] : target;
+    }
+    return cur;
+}
+
+// Closed loop setpoints get a plain acceleration limit
+static int16_t rampVelocity(int lr)
+{
+    int16_t target = targetVelocity[lr];
+
+    if (target > commandVelocity[lr] + VEL_ACCEL_STEP)
+    {
+        commandVelocity[lr] += VEL_ACCEL_STEP;
+    }
+    else if (target < commandVelocity[lr] - VEL_ACCEL_STEP)
+    {
+        commandVelocity[lr] -= VEL_ACCEL_STEP;
+    }
+    else
+    {
+        commandVelocity[lr] = target;
+    }
+    return commandVelocity[lr];
 }
 
 /*
- * Right now speed should be duty cycle 0-100
- * This should be updated to take input of speed in cm/s
- * and calculate pwm required to supply enough voltage,
- * that or we use feedback from our quad encoders.
+ * Applies a signed duty (positive is forward) to both wheels at once. Both
+ * direction bits go out in one toggle of the bits that differ from the last
+ * command, then both duties back to back. Anything that matches the cached
+ * command is not written again.
  */
-void setMoveSpeed(int speed)
+static void driveWheels(int32_t left, int32_t right)
 {
-    uint16_t batVoltage = (AD_ReadADPin(BAT_VOLTAGE) * 33) / 1023; // read the battery voltage
-    if(speed > 50)
+    uint16_t dirBits = 0;
+
+    if (left > MAX_DUTY) left = MAX_DUTY;
+    if (left < -MAX_DUTY) left = -MAX_DUTY;
+    if (right > MAX_DUTY) right = MAX_DUTY;
+    if (right < -MAX_DUTY) right = -MAX_DUTY;
+    appliedDuty[LEFT] = left;
+    appliedDuty[RIGHT] = right;
+
+    // left forward is DIR low, right forward is DIR high
+    if (left < 0)
     {
-        speed = 50;
+        dirBits |= DIR_LEFT_MOTOR;
+        left = -left;
     }
-    else if(speed < 0)
+    if (right >= 0)
     {
-        speed = 0;
-    } 
-    speed = speed * 10; // Duty cycle is set in increments of 1/1000, rather than 1/100
-    speed = speed * MAX_VOLTAGE/batVoltage;
-    PWM_SetDutyCycle(PWM_LEFT_MOTOR,speed);
-    PWM_SetDutyCycle(PWM_RIGHT_MOTOR,speed);
-    
-    return;
+        dirBits |= DIR_RIGHT_MOTOR;
+    }
+    else
+    {
+        right = -right;
+    }
+
+    if (dirBits != lastDirBits)
+    {
+        IO_PortsTogglePortBits(PORTY, dirBits ^ lastDirBits);
+        lastDirBits = dirBits;
+    }
+    if (left != lastPwm[LEFT])
+    {
+        PWM_SetDutyCycle(PWM_LEFT_MOTOR, left);
+        lastPwm[LEFT] = left;
+    }
+    if (right != lastPwm[RIGHT])
+    {
+        PWM_SetDutyCycle(PWM_RIGHT_MOTOR, right);
+        lastPwm[RIGHT] = right;
+    }
 }
 
+/*
+ * Motor tick. Wheel speed is the encoder travel over the last VEL_WINDOW ticks. In open loop
+ * the applied duty takes one profile step toward its target, in closed loop each
+ * wheel gets feed forward plus PI on the error to its ramped setpoint. The
+ * integrator is clamped so a stalled wheel doesn't wind it up.
+ */
+void __ISR(_TIMER_4_VECTOR, ipl2) Timer4IntHandler(void)
+{
+    int lr;
+    int32_t count;
+    int32_t setpoint;
+    int32_t error;
+    int32_t duty[2];
+
+    mT4ClearIntFlag();
+
+    for (lr = LEFT; lr <= RIGHT; lr++)
+    {
+        count = encoderGetCount(lr == LEFT ? ENCODER_LEFT : ENCODER_RIGHT);
+        measuredVelocity[lr] = ((count - countHistory[lr][historyIndex]) * ENCODER_UM_PER_COUNT * MOTOR_TICK_HZ)
+                / (1000 * VEL_WINDOW);
+        countHistory[lr][historyIndex] = count;
+
+        if (!velocityMode)
+        {
+            duty[lr] = rampDuty(lr);
+            continue;
+        }
+
+        setpoint = rampVelocity(lr);
+        error = setpoint - measuredVelocity[lr];
+        velIntegral[lr] += VEL_KI * error;
+        if (velIntegral[lr] > VEL_INTEGRAL_LIMIT)
+        {
+            velIntegral[lr] = VEL_INTEGRAL_LIMIT;
+        }
+        else if (velIntegral[lr] < -VEL_INTEGRAL_LIMIT)
+        {
+            velIntegral[lr] = -VEL_INTEGRAL_LIMIT;
+        }
+
+        duty[lr] = (VEL_KFF * setpoint + VEL_KP * error + velIntegral[lr]) / 256;
+    }
+    if (++historyIndex >= VEL_WINDOW)
+    {
+        historyIndex = 0;
+    }
+    driveWheels(duty[LEFT], duty[RIGHT]);
+}
@@ -0,0 +1,56 @@
+/*
+ * File:   motorDuty.c
+ * Author: jdgrant
+ *
+ * Speed to PWM duty conversion for the drive motors. The battery compensated
+ * duty for every speed step is precomputed whenever the compensation factor
+ * changes, so a motor command is a clamp and a table lookup.
+ *
+ */
+
+#include <stdint.h>
+#include "motorDuty.h"
+
+#define DUTY_PER_SPEED 10 // duty is set in increments of 1/1000, speed in 1/100
+#define MAX_DUTY 1000
+
+static uint16_t dutyTable[MOTOR_MAX_SPEED + 1] = {
+    // uncompensated until the battery monitor hands us a factor
+    0, 10, 20, 30, 40, 50, 60, 70, 80, 90,
+    100, 110, 120, 130, 140, 150, 160, 170, 180, 190,
+    200, 210, 220, 230, 240, 250, 260, 270, 280, 290,
+    300, 310, 320, 330, 340, 350, 360, 370, 380, 390,
+    400, 410, 420, 430, 440, 450, 460, 470, 480, 490,
+    500
+};
+static uint16_t tableCompensation = 1 << MOTOR_DUTY_COMP_SHIFT;
+
+void motorDutySetCompensation(uint16_t compensation)
+{
+    int speed;
+    uint32_t duty;
+
+    if (compensation == tableCompensation)
+    {
+        return;
+    }
+    for (speed = 0; speed <= MOTOR_MAX_SPEED; speed++)
+    {
+        duty = ((uint32_t)speed * DUTY_PER_SPEED * compensation) >> MOTOR_DUTY_COMP_SHIFT;
+        dutyTable[speed] = (duty > MAX_DUTY) ? MAX_DUTY : duty;
+    }
+    tableCompensation = compensation;
+}
+
+uint16_t motorDutyFromSpeed(int speed)
+{
+    if (speed > MOTOR_MAX_SPEED)
+    {
+        speed = MOTOR_MAX_SPEED;
+    }
+    else if (speed < 0)
+    {
+        speed = 0;
+    }
+    return dutyTable[speed];
+}
@@ -7,14 +7,29 @@
  * 
  */
 
+#include <xc.h>
+#include <plib.h>
 #include "BOARD.h"
 #include "IO_Ports.h"
+#include "ES_Configure.h"
+#include "ES_Timers.h"
 #include "AD.h"
 #include "RC_Servo.h"
 #include "sensors.h"
 #include <stdio.h>
 
 //#define DEBUG
+
+static volatile uint16_t bumperLatched = 0; // pressed and not yet released
+static volatile uint16_t bumperPending = 0; // pressed and not yet reported
+static volatile uint32_t bumpTime = 0;
+static volatile uint8_t beaconRaw = FALSE; // level after the last transition
+static volatile uint32_t beaconRawTime = 0; // core timer at the last transition
+static uint8_t beaconState = FALSE; // level that has held for the dwell time
+
+// The core timer counts at half the system clock
+#define CORE_TICKS_PER_US (BOARD_GetSysClock() / 2000000)
+
 uint8_t readTrackWire()
 {
     uint8_t retVal = (IO_PortsReadPort(SENSOR_PORT) & TRACKWIRE_OUTPUT) >> 7;
@@ -33,13 +48,36 @@ uint8_t readTrackWire()
  */
 uint8_t readBumpers()
 {
-    uint8_t retVal = 0;
-    
-    retVal = retVal | (IO_PortsReadPort(BUMPER_PORT) & FR_BUMPER);
-    retVal = retVal | (IO_PortsReadPort(BUMPER_PORT) & FL_BUMPER);
-    retVal = retVal | (IO_PortsReadPort(BUMPER_PORT) & B_BUMPER);
-    
-    return (retVal >> 3);
+    return (IO_PortsReadPort(BUMPER_PORT) & BUMPER_PINS) >> 3;
+}
+
+void readInputSnapshot(InputSnapshot_t *snap)
+{
+    snap->sensorPort = IO_PortsReadPort(SENSOR_PORT);
+    snap->muxPort = IO_PortsReadPort(MUX_PORT);
+    snap->time = ES_Timer_GetTime();
+}
+
+uint8_t snapshotBumpers(const InputSnapshot_t *snap)
+{
+    return (snap->sensorPort & BUMPER_PINS) >> 3;
+}
+
+uint8_t snapshotBeacon(const InputSnapshot_t *snap)
+{
+    // detector output is active low
+    return (snap->sensorPort & BEACONDETECT_OUTPUT) ? FALSE : TRUE;
+}
+
+uint8_t snapshotTrackWire(const InputSnapshot_t *snap)
+{
+    // tank circuit output is active low
+    return (snap->sensorPort & TRACKWIRE_OUTPUT) ? FALSE : TRUE;
+}
+
+uint8_t snapshotTrackWireSelect(const InputSnapshot_t *snap)
+{
+    return (snap->muxPort & MUX_SELECT_A) ? 1 : 0;
 }
 
 void sensorsInit()
@@ -49,6 +87,13 @@ void sensorsInit()
 
     // Init for Bumpers
     IO_PortsSetPortInputs(BUMPER_PORT,FR_BUMPER|FL_BUMPER|B_BUMPER);
+    // Presses and beacon edges are reported straight from the change
+    // notification interrupt
+    beaconRaw = (IO_PortsReadPort(SENSOR_PORT) & BEACONDETECT_OUTPUT) ? FALSE : TRUE; // clears any mismatch
+    beaconState = beaconRaw;
+    beaconRawTime = ReadCoreTimer();
+    mCNOpen(CN_ON | CN_IDLE_CON, BUMPER_CN_PINS | BEACON_CN_PIN, CN_PULLUP_DISABLE_ALL);
+    ConfigIntCN(CHANGE_INT_ON | CHANGE_INT_PRI_2);
     
     // Init for multiplexer select
     IO_PortsSetPortOutputs(MUX_PORT,MUX_SELECT_A);
@@ -75,13 +120,15 @@ uint8_t readBeaconDetector()
  */
 void muxSelTrackWire(uint8_t selectMask)
 {
+    // The tape LEDs share this port and are toggled from the capture ISR, so only
+    // touch our own bit instead of writing back a stale read of the whole port.
     if (selectMask)
     {
-        IO_PortsWritePort(MUX_PORT,IO_PortsReadPort(MUX_PORT) | MUX_SELECT_A); // This sets select A on the mux
+        IO_PortsSetPortBits(MUX_PORT, MUX_SELECT_A); // This sets select A on the mux
     }
     else
     {
-        IO_PortsWritePort(MUX_PORT,IO_PortsReadPort(MUX_PORT) & ~MUX_SELECT_A); // This clears select A on the mux
+        IO_PortsClearPortBits(MUX_PORT, MUX_SELECT_A); // This clears select A on the mux
     }
     return;
 }
@@ -98,3 +145,102 @@ void setPulseBridgeServo(uint16_t pulse)
     return;
 }
    
+
+uint16_t bumperEdgePending()
+{
+    uint16_t pins;
+
+    mCNIntEnable(0);
+    pins = bumperPending;
+    bumperPending = 0;
+    mCNIntEnable(1);
+    return pins;
+}
+
+uint16_t bumperEdgeClaim(uint16_t pins)
+{
+    mCNIntEnable(0);
+    pins &= ~bumperLatched;
+    if (pins)
+    {
+        bumperLatched |= pins;
+        bumpTime = ES_Timer_GetTime();
+    }
+    mCNIntEnable(1);
+    return pins;
+}
+
+void bumperEdgeRelease(uint16_t pins)
+{
+    mCNIntEnable(0);
+    bumperLatched &= ~pins;
+    mCNIntEnable(1);
+}
+
+uint16_t bumperEdgeLatched()
+{
+    return bumperLatched;
+}
+
+uint32_t getBumpTime()
+{
+    return bumpTime;
+}
+
+/*
+ * The ISR only keeps the last transition, so a level counts once nothing has
+ * moved for BEACON_DWELL_US. The edge is dated by that last transition rather
+ * than by when we got around to checking.
+ */
+uint8_t beaconEdgePending(uint8_t *seen, uint32_t *time)
+{
+    uint8_t raw;
+    uint32_t rawTime;
+    uint32_t age;
+
+    mCNIntEnable(0);
+    raw = beaconRaw;
+    rawTime = beaconRawTime;
+    mCNIntEnable(1);
+
+    if (raw == beaconState)
+    {
+        return FALSE;
+    }
+    age = ReadCoreTimer() - rawTime;
+    if (age < BEACON_DWELL_US * CORE_TICKS_PER_US)
+    {
+        return FALSE;
+    }
+    beaconState = raw;
+    *seen = raw;
+    *time = ES_Timer_GetTime() - age / (CORE_TICKS_PER_US * 1000);
+    return TRUE;
+}
+
+/*
+ * Any bumper pin that goes high and isn't latched is a new press, it is reported
+ * on this very edge. The bounces that follow land on a latched pin and are
+ * ignored until the debounced release re-arms it. Beacon transitions are only
+ * timestamped here, beaconEdgePending() decides which ones stuck.
+ */
+void __ISR(_CHANGE_NOTICE_VECTOR, ipl2) ChangeNoticeIntHandler(void)
+{
+    uint16_t port = IO_PortsReadPort(SENSOR_PORT); // read clears the mismatch
+    uint16_t pressed = port & BUMPER_PINS;
+    uint8_t beacon = (port & BEACONDETECT_OUTPUT) ? FALSE : TRUE; // active low
+
+    mCNClearIntFlag();
+    if (beacon != beaconRaw)
+    {
+        beaconRaw = beacon;
+        beaconRawTime = ReadCoreTimer();
+    }
+    pressed &= ~bumperLatched;
+    if (pressed)
+    {
+        bumperLatched |= pressed;
+        bumperPending |= pressed;
+        bumpTime = ES_Timer_GetTime();
+    }
+}
@@ -0,0 +1,128 @@
+/*
+ * File:   tapeCapture.c
+ * Author: TeamPutterWorth
+ *
+ * Hardware timed capture engine for the five TCRT5000 tape sensors. Timer5
+ * toggles the emitter LEDs and latches every channel a fixed settle time after
+ * each LED edge, so SyncSampling only has to pick up finished on/off frames.
+ * Every phase sums TAPE_OVERSAMPLE conversions so a single noisy conversion
+ * can't flip a tape decision.
+ *
+ * The PIC32MX320 has no DMA controller, so the Timer5 ISR latches the five
+ * channels itself. It writes into the back half of a double buffer and swaps
+ * once the off phase is done, the service never sees a half written frame.
+ *
+ */
+
+#include <xc.h>
+#include <plib.h>
+#include "BOARD.h"
+#include "IO_Ports.h"
+#include "AD.h"
+#include "tapeCapture.h"
+#include "trackWireCapture.h"
+
+//#define DEBUG
+#define LED_PORT PORTZ
+#define LED_PINS (PIN3|PIN4|PIN5|PIN7|PIN8)
+#define AD_TAPE_PINS (AD_PORTV3|AD_PORTV4|AD_PORTV5|AD_PORTV6|AD_PORTV7)
+#define TIMER_5_PRESCALE 8
+#define US_PER_SECOND 1000000
+#define LED_ON_PHASE 0
+#define LED_OFF_PHASE 1
+
+static const unsigned int adPins[] = {AD_PORTV3,AD_PORTV4,AD_PORTV5,AD_PORTV6,AD_PORTV7};
+
+static TapeFrame_t frames[2];
+static volatile uint8_t frontIndex = 0; // last complete frame
+static volatile uint8_t frameReady = FALSE;
+static uint8_t backIndex = 1; // frame the ISR is filling
+static uint8_t phase = LED_ON_PHASE;
+static uint8_t tick = 0; // ticks since the last LED edge
+
+void tapeCaptureInit()
+{
+    IO_PortsSetPortOutputs(LED_PORT, LED_PINS);
+    AD_AddPins(AD_TAPE_PINS);
+
+    // LEDs start on so the first phase latches the on readings
+    IO_PortsSetPortBits(LED_PORT, LED_PINS);
+    phase = LED_ON_PHASE;
+    tick = 0;
+
+    OpenTimer5(T5_ON | T5_SOURCE_INT | T5_PS_1_8,
+            BOARD_GetPBClock() / TIMER_5_PRESCALE / (US_PER_SECOND / TAPE_TICK_US));
+    ConfigIntTimer5(T5_INT_ON | T5_INT_PRIOR_3);
+}
+
+uint8_t tapeCaptureFrameReady()
+{
+    if (frameReady)
+    {
+        frameReady = FALSE;
+        return TRUE;
+    }
+    return FALSE;
+}
+
+void tapeCaptureReadFrame(TapeFrame_t *frame)
+{
+    // Hold off the ISR so it can't swap buffers in the middle of the copy
+    DisableIntT5;
+    *frame = frames[frontIndex];
+    EnableIntT5;
+}
+
+/*
+ * Each interrupt is one tick. The first TAPE_SETTLE_TICKS after an LED edge are
+ * skipped, the next TAPE_OVERSAMPLE ticks add one conversion per channel to the
+ * phase we are in, then the LEDs flip to start the next one.
+ */
+void __ISR(_TIMER_5_VECTOR, ipl3) Timer5IntHandler(void)
+{
+    int i;
+    TapeFrame_t *back = &frames[backIndex];
+    uint16_t *acc = (phase == LED_ON_PHASE) ? back->on : back->off;
+
+    mT5ClearIntFlag();
+    trackWireCaptureTick();
+
+    if (tick < TAPE_SETTLE_TICKS)
+    {
+        tick++;
+        return;
+    }
+
+    for (i = 0; i < TAPE_NUM_SENSORS; i++)
+    {
+        if (tick == TAPE_SETTLE_TICKS)
+        {
+            acc[i] = 0;
+        }
+        acc[i] += AD_ReadADPin(adPins[i]);
+    }
+    tick++;
+
+    if (tick < TAPE_SETTLE_TICKS + TAPE_OVERSAMPLE)
+    {
+        return;
+    }
+    tick = 0;
+
+    if (phase == LED_ON_PHASE)
+    {
+        IO_PortsClearPortBits(LED_PORT, LED_PINS);
+        phase = LED_OFF_PHASE;
+    }
+    else
+    {
+        IO_PortsSetPortBits(LED_PORT, LED_PINS);
+        phase = LED_ON_PHASE;
+
+        // Publish the finished frame and start filling the other half
+        back->sequence = frames[frontIndex].sequence + 1;
+        frontIndex = backIndex;
+        backIndex ^= 1;
+        frameReady = TRUE;
+    }
+}
@@ -0,0 +1,94 @@
+/*
+ * File:   trackWireCapture.c
+ * Author: TeamPutterWorth
+ *
+ * Interrupt timed sampler for the two track wire detectors. Runs off the tape
+ * capture Timer5 tick, which also owns the rest of the mux port, so the select
+ * line and the tape LEDs are never written from two places.
+ *
+ */
+
+#include <xc.h>
+#include <plib.h>
+#include "BOARD.h"
+#include "IO_Ports.h"
+#include "sensors.h"
+#include "debounce.h"
+#include "tapeCapture.h"
+#include "trackWireCapture.h"
+
+#define FRONT_TRACK_WIRE 0
+#define BACK_TRACK_WIRE 1
+#define TW_SETTLE_TICKS (TW_SETTLE_US / TAPE_TICK_US)
+
+// Thresholds in samples of one channel
+#define TW_PRESS 3
+#define TW_RELEASE 1
+
+static Debouncer_t wires;
+static OnFraction_t strength[2];
+static uint8_t channel = FRONT_TRACK_WIRE;
+static uint8_t tick = 0;
+static volatile uint8_t changed = FALSE;
+
+void trackWireCaptureInit()
+{
+    debounceInit(&wires, 0);
+    debounceSetThreshold(&wires, TW_F | TW_B, TW_PRESS, TW_RELEASE);
+    onFractionInit(&strength[FRONT_TRACK_WIRE]);
+    onFractionInit(&strength[BACK_TRACK_WIRE]);
+    channel = FRONT_TRACK_WIRE;
+    tick = 0;
+    changed = FALSE;
+    muxSelTrackWire(FRONT_TRACK_WIRE);
+}
+
+/*
+ * The channel selected TW_SETTLE_TICKS ago is read, run through its debouncer
+ * and the mux moves on to the other one.
+ */
+void trackWireCaptureTick()
+{
+    uint8_t bit = (channel == FRONT_TRACK_WIRE) ? TW_F : TW_B;
+    uint8_t on;
+
+    if (++tick < TW_SETTLE_TICKS)
+    {
+        return;
+    }
+    tick = 0;
+
+    // tank circuit output is active low
+    on = (IO_PortsReadPort(SENSOR_PORT) & TRACKWIRE_OUTPUT) ? 0 : bit;
+    onFractionUpdate(&strength[channel], on);
+    if (debounceUpdate(&wires, on, bit))
+    {
+        changed = TRUE;
+    }
+
+    channel = (channel == FRONT_TRACK_WIRE) ? BACK_TRACK_WIRE : FRONT_TRACK_WIRE;
+    muxSelTrackWire(channel);
+}
+
+uint8_t trackWireCaptureChanged(uint8_t *state)
+{
+    if (!changed)
+    {
+        return FALSE;
+    }
+    DisableIntT5;
+    changed = FALSE;
+    *state = debounceState(&wires);
+    EnableIntT5;
+    return TRUE;
+}
+
+uint8_t trackWireCaptureState()
+{
+    return debounceState(&wires);
+}
+
+uint8_t trackWireCaptureStrength(uint8_t wire)
+{
+    return onFractionGet(&strength[wire]);
+}
@@ -57,6 +57,12 @@ typedef enum {
     BEACON_TRIGGERED,
     BATTERY_CONNECTED,
     BATTERY_DISCONNECTED,
+    TAPE_FRAME_READY,
+    TAPE_LOST,
+    APPROACH_DONE,
+    TURN_DONE,
+    SERVO_DONE,
+    POSE_UPDATED,
     NUMBEROFEVENTS,
 } ES_EventTyp_t;
 
@@ -84,6 +90,12 @@ static const char *EventNames[] = {
 	"BEACON_TRIGGERED",
 	"BATTERY_CONNECTED",
 	"BATTERY_DISCONNECTED",
+	"TAPE_FRAME_READY",
+	"TAPE_LOST",
+	"APPROACH_DONE",
+	"TURN_DONE",
+	"SERVO_DONE",
+	"POSE_UPDATED",
 	"NUMBEROFEVENTS",
 };
 
@@ -92,30 +104,30 @@ static const char *EventNames[] = {
 
 /****************************************************************************/
 // This are the name of the Event checking function header file. 
-// Our events are now legacy code and not actually run.
+// The track wire and beacon checkers are legacy code and not actually run.
 #define EVENT_CHECK_HEADER "EventChecker.h" 
 /****************************************************************************/
 // This is the list of event checking functions
-#define EVENT_CHECK_LIST 
+#define EVENT_CHECK_LIST checkTapeFrame, checkBumperEdge, checkTrackWireEdge, checkBeaconEdge
 
 /****************************************************************************/
 // These are the definitions for the post functions to be executed when the
 // corresponding timer expires. All 16 must be defined. If you are not using
 // a timers, then you can use TIMER_UNUSED
 #define TIMER_UNUSED ((pPostFunc)0)
-#define TIMER0_RESP_FUNC PostSyncSamplingService
+#define TIMER0_RESP_FUNC TIMER_UNUSED
 #define TIMER1_RESP_FUNC PostTopLevelHSM
 #define TIMER2_RESP_FUNC PostTopLevelHSM
 #define TIMER3_RESP_FUNC PostTopLevelHSM
-#define TIMER4_RESP_FUNC PostBumperDebounceService
-#define TIMER5_RESP_FUNC PostTrackWireService
+#define TIMER4_RESP_FUNC PostInputSamplingService
+#define TIMER5_RESP_FUNC PostBatteryMonitorService
 #define TIMER6_RESP_FUNC PostTopLevelHSM
 #define TIMER7_RESP_FUNC PostTopLevelHSM
 #define TIMER8_RESP_FUNC PostTopLevelHSM
 #define TIMER9_RESP_FUNC PostTopLevelHSM
-#define TIMER10_RESP_FUNC PostBeaconDebounceService
+#define TIMER10_RESP_FUNC PostPoseEstimatorService
 #define TIMER11_RESP_FUNC PostTopLevelHSM
-#define TIMER12_RESP_FUNC PostTopLevelHSM
+#define TIMER12_RESP_FUNC PostServoMotionService
 #define TIMER13_RESP_FUNC PostTopLevelHSM
 #define TIMER14_RESP_FUNC PostTopLevelHSM
 #define TIMER15_RESP_FUNC PostTopLevelHSM
@@ -129,17 +141,16 @@ static const char *EventNames[] = {
 // Simple service timer is only for keyboard inputs
 #define SIMPLE_SERVICE_TIMER 0
 
-#define SYNC_SAMPLE_TIMER 0 /*make sure this is enabled above and posting to the correct state machine*/
 #define SHORT_HSM_TIMER 1
 #define MEDIUM_HSM_TIMER 2
 #define LONG_HSM_TIMER 3
-#define BUMPER_DEBOUNCE_TIMER 4
-#define TRACK_WIRE_TIMER 5
+#define INPUT_SAMPLE_TIMER 4
+#define BATTERY_TIMER 5
+#define POSE_TIMER 10
 #define TIMER_22 9
 #define TIMER_45 6
 #define TIMER_90 7
 #define TIMER_180 8
-#define BEACON_DEBOUNCE_TIMER 10
 #define TIMER_360 11
 #define SERVO_TIMER 12
 #define SHIMMY_TIMER 13
@@ -152,12 +163,6 @@ static const char *EventNames[] = {
 #define MEDIUM_TIMER_TICKS 275 
 #define LONG_TIMER_TICKS 1000
 
-#define TIMER_45_TICKS 700
-#define TIMER_22_TICKS TIMER_45_TICKS/2
-#define TIMER_360_TICKS 3150
-#define TIMER_90_TICKS (TIMER_360_TICKS/4)-75
-#define TIMER_180_TICKS TIMER_360_TICKS/2
-
 #define SHIMMY_TIMER_TICKS 100
 #define SCAN_TIMER_TICKS 2000
 #define RANDALL_TIMER_TICKS 500
@@ -172,7 +177,7 @@ static const char *EventNames[] = {
 /****************************************************************************/
 // This macro determines that nuber of services that are *actually* used in
 // a particular application. It will vary in value from 1 to MAX_NUM_SERVICES
-#define NUM_SERVICES 6
+#define NUM_SERVICES 8
 
 /****************************************************************************/
 // These are the definitions for Service 0, the lowest priority service
@@ -218,11 +223,11 @@ static const char *EventNames[] = {
 // These are the definitions for Service 3
 #if NUM_SERVICES > 3
 // the header file with the public fuction prototypes
-#define SERV_3_HEADER "BumperDebounce.h"
+#define SERV_3_HEADER "InputSampling.h"
 // the name of the Init function
-#define SERV_3_INIT InitBumperDebounceService
+#define SERV_3_INIT InitInputSamplingService
 // the name of the run function
-#define SERV_3_RUN RunBumperDebounceService
+#define SERV_3_RUN RunInputSamplingService
 // How big should this services Queue be?
 #define SERV_3_QUEUE_SIZE 3
 #endif
@@ -231,11 +236,11 @@ static const char *EventNames[] = {
 // These are the definitions for Service 4
 #if NUM_SERVICES > 4
 // the header file with the public fuction prototypes
-#define SERV_4_HEADER "TrackWire.h"
+#define SERV_4_HEADER "BatteryMonitor.h"
 // the name of the Init function
-#define SERV_4_INIT InitTrackWireService
+#define SERV_4_INIT InitBatteryMonitorService
 // the name of the run function
-#define SERV_4_RUN RunTrackWireService
+#define SERV_4_RUN RunBatteryMonitorService
 // How big should this services Queue be?
 #define SERV_4_QUEUE_SIZE 3
 #endif
@@ -244,11 +249,11 @@ static const char *EventNames[] = {
 // These are the definitions for Service 5
 #if NUM_SERVICES > 5
 // the header file with the public fuction prototypes
-#define SERV_5_HEADER "BeaconDebounce.h"
+#define SERV_5_HEADER "PoseEstimator.h"
 // the name of the Init function
-#define SERV_5_INIT InitBeaconDebounceService
+#define SERV_5_INIT InitPoseEstimatorService
 // the name of the run function
-#define SERV_5_RUN RunBeaconDebounceService
+#define SERV_5_RUN RunPoseEstimatorService
 // How big should this services Queue be?
 #define SERV_5_QUEUE_SIZE 3
 #endif
@@ -257,11 +262,11 @@ static const char *EventNames[] = {
 // These are the definitions for Service 6
 #if NUM_SERVICES > 6
 // the header file with the public fuction prototypes
-#define SERV_6_HEADER "TestService.h"
+#define SERV_6_HEADER "ServoMotion.h"
 // the name of the Init function
-#define SERV_6_INIT TestServiceInit
+#define SERV_6_INIT InitServoMotionService
 // the name of the run function
-#define SERV_6_RUN TestServiceRun
+#define SERV_6_RUN RunServoMotionService
 // How big should this services Queue be?
 #define SERV_6_QUEUE_SIZE 3
 #endif
@@ -270,11 +275,11 @@ static const char *EventNames[] = {
 // These are the definitions for Service 7
 #if NUM_SERVICES > 7
 // the header file with the public fuction prototypes
-#define SERV_7_HEADER "TestService.h"
+#define SERV_7_HEADER "MotionControl.h"
 // the name of the Init function
-#define SERV_7_INIT TestServiceInit
+#define SERV_7_INIT InitMotionControlService
 // the name of the run function
-#define SERV_7_RUN TestServiceRun
+#define SERV_7_RUN RunMotionControlService
 // How big should this services Queue be?
 #define SERV_7_QUEUE_SIZE 3
 #endif
@@ -291,9 +296,10 @@ static const char *EventNames[] = {
 // These are the definitions for the Distribution lists. Each definition
 // should be a comma seperated list of post functions to indicate which
 // services are on that distribution list.
-#define NUM_DIST_LISTS 0
+// List 0 gets POSE_UPDATED from the PoseEstimator after every step
+#define NUM_DIST_LISTS 1
 #if NUM_DIST_LISTS > 0 
-#define DIST_LIST0 PostTemplateFSM
+#define DIST_LIST0 PostMotionControlService
 #endif
 #if NUM_DIST_LISTS > 1 
 #define DIST_LIST1 PostTemplateFSM
@@ -60,6 +60,50 @@
 uint8_t trackWireSignal(void);
 uint8_t beaconSignal(void);
 
+/**
+ * @Function checkTapeFrame(void)
+ * @param none
+ * @return TRUE or FALSE
+ * @brief Posts TAPE_FRAME_READY to the SyncSampling service whenever the Timer5
+ *        capture engine has published a new on/off frame. Returns TRUE if there
+ *        was an event, FALSE otherwise.
+ */
+uint8_t checkTapeFrame(void);
+
+/**
+ * @Function checkBumperEdge(void)
+ * @param none
+ * @return TRUE or FALSE
+ * @brief Posts BUMPED to the TopLevelHSM for bumpers the change notification ISR
+ *        saw pressed. The param is the mask of bumper pins, the time of the edge
+ *        is available from getBumpTime(). Returns TRUE if there was an event,
+ *        FALSE otherwise.
+ */
+uint8_t checkBumperEdge(void);
+
+/**
+ * @Function checkTrackWireEdge(void)
+ * @param none
+ * @return TRUE or FALSE
+ * @brief Posts TW_TRIGGERED to the TopLevelHSM when the Timer5 track wire
+ *        sampler debounces a change on either wire. The param has TW_F and TW_B
+ *        set for the wires that are on. Returns TRUE if there was an event,
+ *        FALSE otherwise.
+ */
+uint8_t checkTrackWireEdge(void);
+
+/**
+ * @Function checkBeaconEdge(void)
+ * @param none
+ * @return TRUE or FALSE
+ * @brief Posts BEACON_TRIGGERED to the InputSampling service once a beacon edge
+ *        timestamped by the change notification ISR has held for
+ *        BEACON_DWELL_US. The param is BEACON_EDGE_PARAM() of the new level
+ *        and the edge time. Returns TRUE if there was an event, FALSE
+ *        otherwise.
+ */
+uint8_t checkBeaconEdge(void);
+
 
 
 #endif	/* TEMPLATEEVENTCHECKER_H */
\ No newline at end of file
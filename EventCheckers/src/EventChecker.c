@@ -13,6 +13,10 @@
 #include "AD.h"
 #include "pwm.h"
 #include "LED.h"
+#include "ES_Framework.h"
+#include "tapeCapture.h"
+#include "trackWireCapture.h"
+#include "sensors.h"
 
 /*******************************************************************************
  * MODULE #DEFINES                                                             *
@@ -106,3 +110,59 @@ uint8_t beaconSignal(void) {
     }
     return (returnREAD);
 }
+
+uint8_t checkTapeFrame(void) {
+    ES_Event thisEvent;
+
+    // The capture ISR can't post to a queue itself, so it raises a flag for us
+    if (tapeCaptureFrameReady()) {
+        thisEvent.EventType = TAPE_FRAME_READY;
+        thisEvent.EventParam = 0;
+        PostSyncSamplingService(thisEvent);
+        return TRUE;
+    }
+    return FALSE;
+}
+
+uint8_t checkBumperEdge(void) {
+    ES_Event thisEvent;
+    uint16_t pins = bumperEdgePending();
+
+    // Pressed pins were latched in the change notification ISR on the first edge
+    if (pins) {
+        thisEvent.EventType = BUMPED;
+        thisEvent.EventParam = pins;
+        PostTopLevelHSM(thisEvent);
+        return TRUE;
+    }
+    return FALSE;
+}
+
+uint8_t checkTrackWireEdge(void) {
+    ES_Event thisEvent;
+    uint8_t state;
+
+    // Debounced in the Timer5 ISR, we only see each change once
+    if (trackWireCaptureChanged(&state)) {
+        thisEvent.EventType = TW_TRIGGERED;
+        thisEvent.EventParam = state;
+        PostTopLevelHSM(thisEvent);
+        return TRUE;
+    }
+    return FALSE;
+}
+
+uint8_t checkBeaconEdge(void) {
+    ES_Event thisEvent;
+    uint8_t seen;
+    uint32_t time;
+
+    // InputSampling works out the lobe bearing and passes it on to the HSM
+    if (beaconEdgePending(&seen, &time)) {
+        thisEvent.EventType = BEACON_TRIGGERED;
+        thisEvent.EventParam = BEACON_EDGE_PARAM(seen, time);
+        PostInputSamplingService(thisEvent);
+        return TRUE;
+    }
+    return FALSE;
+}
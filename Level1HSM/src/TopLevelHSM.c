@@ -25,7 +25,11 @@
 #include "SecondTargetUnloadSubHSM.h"
 #include "sensors.h"
 #include "SyncSampling.h"
-#include "BeaconDebounce.h"
+#include "InputSampling.h"
+#include "PoseEstimator.h"
+#include "MissionMemory.h"
+#include "TurnControl.h"
+#include "TowerHoming.h"
 
 /*******************************************************************************
  * PRIVATE #DEFINES                                                            *
@@ -35,6 +39,8 @@
  * MODULE #DEFINES                                                             *
  ******************************************************************************/
 #define PLUNGER_BUMPER 0x4
+// We only know we're somewhere on the face of the tower, about its half width
+#define TOWER_POSITION_VAR (100 * 100)
 
 typedef enum {
     InitPState,
@@ -149,6 +155,11 @@ ES_Event RunTopLevelHSM(ES_Event ThisEvent)
             ES_Timer_StopTimer(TIMER_90);
             ES_Timer_StopTimer(TIMER_180);
             ES_Timer_StopTimer(TIMER_360);
+            // sub HSMs that start with a direct approach or a turn kicked them
+            // off above, the active one starts its own again on entry
+            missionApproachStop();
+            turnStop();
+            towerHomingStop();
             
             // now put the machine into the actual initial state
             nextState = AmmoSearch;
@@ -167,6 +178,10 @@ ES_Event RunTopLevelHSM(ES_Event ThisEvent)
             case TW_TRIGGERED:
                 // check if rising edge
                 if((ThisEvent.EventParam & TW_B) && getLastTape() != NOT_FOLLOWING){
+                    // the loading tower is the origin of the pose frame
+                    poseCorrectX(POSE_TOWER_X, TOWER_POSITION_VAR);
+                    poseCorrectY(POSE_TOWER_Y, TOWER_POSITION_VAR);
+                    missionRecord(MISSION_TOWER);
                     nextState = AmmoLoad;
                     makeTransition = TRUE;
                     ThisEvent.EventType = ES_NO_EVENT;
@@ -197,6 +212,7 @@ ES_Event RunTopLevelHSM(ES_Event ThisEvent)
         switch (ThisEvent.EventType) {
             case TAPE_TRIGGERED:
                 if(ThisEvent.EventParam & (TS_FL | TS_FR) && getBeaconVal()){
+                    missionRecord(MISSION_FIRST_TARGET);
                     nextState = FirstTargetUnload;
                     makeTransition = TRUE;
                     ThisEvent.EventType = ES_NO_EVENT;
@@ -247,6 +263,7 @@ ES_Event RunTopLevelHSM(ES_Event ThisEvent)
             
             case TAPE_TRIGGERED:
                 if(ThisEvent.EventParam & (TS_FR | TS_FL)){
+                    missionRecord(MISSION_SECOND_TARGET);
                     nextState = SecondTargetUnload;
                     makeTransition = TRUE;
                     ThisEvent.EventType = ES_NO_EVENT;
@@ -277,6 +294,9 @@ ES_Event RunTopLevelHSM(ES_Event ThisEvent)
                 ES_Timer_StopTimer(TIMER_90);
                 ES_Timer_StopTimer(TIMER_180);
                 ES_Timer_StopTimer(TIMER_360);
+                missionApproachStop();
+                turnStop();
+                towerHomingStop();
 
                 // now put the machine into the actual initial state
                 nextState = AmmoSearch;
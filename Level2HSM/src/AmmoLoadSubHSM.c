@@ -19,32 +19,32 @@
 #include "SyncSampling.h"
 #include "sensors.h"
 #include "motor.h"
+#include "ManeuverTimer.h"
+#include "TowerHoming.h"
+#include "PoseEstimator.h"
 
 /*******************************************************************************
  * PRIVATE #DEFINES                                                            *
  ******************************************************************************/
 #define LEFT 0
 #define RIGHT 1
+// Flat against a tower face the robot is square to the arena to about 5 degrees
+// (brad^2)
+#define TOWER_HEADING_VAR (910L * 910L)
 /*******************************************************************************
  * MODULE #DEFINES                                                             *
  ******************************************************************************/
 
 typedef enum {
     InitPState,
-    TankTurn,
-    Backward,
-    Forward,
-    PivotTurn,
+    Homing,
     Shimmy,
     QuickForward,
 } HSMState_t;
 
 static const char *StateNames[] = {
 	"InitPState",
-	"TankTurn",
-	"Backward",
-	"Forward",
-	"PivotTurn",
+	"Homing",
 	"Shimmy",
 	"QuickForward",
 };
@@ -106,97 +106,38 @@ ES_Event RunAmmoLoadSubHSM(ES_Event ThisEvent)
 {
     uint8_t makeTransition = FALSE; // use to flag transition
     HSMState_t nextState; // <- change type to correct enum
-    uint8_t lastTape = getLastTape();
-    static uint8_t pivotState = LEFT;
+    Pose_t pose;
     ES_Tattle(); // trace call stack
 
     switch (CurrentState) {
     case InitPState: // If current state is initial Pseudo State
         if (ThisEvent.EventType == ES_INIT)// only respond to ES_Init
         {
-            nextState = PivotTurn;
+            nextState = Homing;
             makeTransition = TRUE;
             ThisEvent.EventType = ES_NO_EVENT;
         }
         break;
-    case PivotTurn:
-        switch (ThisEvent.EventType){
-            case ES_ENTRY:
-                if(lastTape){
-                    pivotTurnLeftBackward();
-                    pivotState = LEFT;
-                }else{
-                    pivotTurnRightBackward();
-                    pivotState = RIGHT;
-                }
-                break;
-            case TAPE_TRIGGERED:
-                if(ThisEvent.EventParam & TS_BR && pivotState == RIGHT){
-                    nextState = Forward;
-                    makeTransition = TRUE;
-                    ThisEvent.EventType = ES_NO_EVENT;
-                }else if(ThisEvent.EventParam & TS_BL && pivotState == LEFT){
-                    nextState = Forward;
-                    makeTransition = TRUE;
-                    ThisEvent.EventType = ES_NO_EVENT;
-                }
-                break;
-        }
-        break;
-    case Forward:
-        switch(ThisEvent.EventType)
-        {
+    case Homing:
+        switch (ThisEvent.EventType) {
             case ES_ENTRY:
-                moveForward();
+                // back straight into the tower along the track wire field
+                towerHomingStart();
+                maneuverTimerStart(LONG_HSM_TIMER, 3*LONG_TIMER_TICKS);
                 break;
-            case TW_TRIGGERED:
-                if(ThisEvent.EventParam & TW_B)
+            case BUMPED:
+                if(ThisEvent.EventParam & B_BUMPER)
                 {
-                    nextState = TankTurn;
-                    makeTransition = TRUE;
-                    ThisEvent.EventType = ES_NO_EVENT;
-                }
-                break;              
-        }
-        break;
-            
-    case TankTurn:
-        switch (ThisEvent.EventType) {  
-            case ES_ENTRY:
-                ES_Timer_InitTimer(TIMER_45, TIMER_45_TICKS);
-                if(pivotState == RIGHT)
-                {
-                    tankTurnRight();
-                }
-                else if(pivotState == LEFT)
-                {
-                    tankTurnLeft();
-                }
-                break;
-            case ES_TIMEOUT:
-                if(ThisEvent.EventParam == TIMER_45){
-                    nextState = Backward;
+                    // back flat on the tower, this is where the heading is fixed
+                    poseGet(&pose);
+                    poseCorrectSquare(pose.heading, TOWER_HEADING_VAR);
+                    nextState = Shimmy;
                     makeTransition = TRUE;
                     ThisEvent.EventType = ES_NO_EVENT;
                 }
                 break;
-            case ES_EXIT:
-                ES_Timer_StopTimer(TIMER_45);
-                break;
-            case ES_NO_EVENT:
-            default:
-                break;
-        }
-        break;
-        
-    case Backward:
-        switch (ThisEvent.EventType) {
-            case ES_ENTRY:
-                moveBackward();
-                setMoveSpeed(40);
-                ES_Timer_InitTimer(LONG_HSM_TIMER, LONG_TIMER_TICKS+500);
-                break;
             case ES_TIMEOUT:
+                // never felt the bumper, we're up against it as well as we'll get
                 if(ThisEvent.EventParam == LONG_HSM_TIMER)
                 {
                     nextState = Shimmy;
@@ -205,6 +146,7 @@ ES_Event RunAmmoLoadSubHSM(ES_Event ThisEvent)
                 }
                 break;
             case ES_EXIT:
+                towerHomingStop();
                 ES_Timer_StopTimer(LONG_HSM_TIMER);
                 break;
             case ES_NO_EVENT:
@@ -241,7 +183,7 @@ ES_Event RunAmmoLoadSubHSM(ES_Event ThisEvent)
                     nextState = QuickForward;
                     makeTransition = TRUE;
                     ThisEvent.EventType = ES_NO_EVENT;
-                    ES_Timer_InitTimer(MEDIUM_HSM_TIMER, MEDIUM_TIMER_TICKS);
+                    maneuverTimerStart(MEDIUM_HSM_TIMER, MEDIUM_TIMER_TICKS);
                 }
                 break;
         }
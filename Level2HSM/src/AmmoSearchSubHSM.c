@@ -18,6 +18,11 @@
 #include "AmmoSearchSubHSM.h"
 #include "sensors.h"
 #include "motor.h"
+#include "TapeFollow.h"
+#include "SyncSampling.h"
+#include "MissionMemory.h"
+#include "TurnControl.h"
+#include "ManeuverTimer.h"
 
 /*******************************************************************************
  * PRIVATE #DEFINES                                                            *
@@ -32,6 +37,7 @@
 
 typedef enum {
     InitPState,
+    DirectApproach,
     Start,        
     Forward,
     TankTurn,
@@ -43,6 +49,7 @@ typedef enum {
 
 static const char *StateNames[] = {
 	"InitPState",
+	"DirectApproach",
 	"Start",
 	"Forward",
 	"TankTurn",
@@ -67,6 +74,7 @@ static const char *StateNames[] = {
 
 static HSMState_t CurrentState = InitPState; // <- change enum name to match ENUM
 static uint8_t MyPriority;
+static int16_t turnAngle = 180; // degrees for the next TankTurn/TankTurnAvoid
 
 
 /*******************************************************************************
@@ -108,6 +116,7 @@ ES_Event RunAmmoSearchSubHSM(ES_Event ThisEvent)
     static uint8_t stuckCounter; // use this to see if we are stuck!
     static uint8_t tapeSide; 
     static uint8_t forwardTimeoutFlag;
+    int16_t approachAngle;
     
     HSMState_t nextState; // <- change type to correct enum
 
@@ -117,20 +126,69 @@ ES_Event RunAmmoSearchSubHSM(ES_Event ThisEvent)
     case InitPState: // If current state is initial Pseudo State
         if (ThisEvent.EventType == ES_INIT)// only respond to ES_Init
         {
-            nextState = Start;
+            // go straight back to the tower if we know where it is
+            nextState = missionRemembered(MISSION_TOWER) ? DirectApproach : Start;
             makeTransition = TRUE;
             ThisEvent.EventType = ES_NO_EVENT;
         }
         break;
+    case DirectApproach:
+        setLastTape(NOT_FOLLOWING);
+        switch(ThisEvent.EventType){
+            case ES_ENTRY:
+                missionApproachStart(MISSION_TOWER);
+                break;
+            case TAPE_TRIGGERED:
+                // the tower sits on tape, pick it up the same way Forward does
+                if (ThisEvent.EventParam & TS_FR){
+                    turnParam = LEFT;
+                    nextState = AlignToTape;
+                    makeTransition = TRUE;
+                    ThisEvent.EventType = ES_NO_EVENT;
+                }else if (ThisEvent.EventParam & TS_FL){
+                    turnParam = RIGHT;
+                    nextState = AlignToTape;
+                    makeTransition = TRUE;
+                    ThisEvent.EventType = ES_NO_EVENT;
+                }
+                break;
+            case BUMPED:
+                if (ThisEvent.EventParam & (FL_BUMPER | FR_BUMPER)){
+                    nextState = Start;
+                    makeTransition = TRUE;
+                    ThisEvent.EventType = ES_NO_EVENT;
+                }
+                break;
+            case APPROACH_DONE:
+                if (ThisEvent.EventParam == APPROACH_FAILED){
+                    missionForget(MISSION_TOWER);
+                }
+                nextState = Start;
+                makeTransition = TRUE;
+                ThisEvent.EventType = ES_NO_EVENT;
+                break;
+            case ES_EXIT:
+                missionApproachStop();
+                break;
+            case ES_NO_EVENT:
+            default:
+                break;
+        }
+        break;
     case Start:
         switch(ThisEvent.EventType){
             case ES_ENTRY:
+                // a steady spin past the tape, good for checking the turn rate
                 tankTurnRight();
+                turnRateMeasureStart();
+                break;
+            case ES_EXIT:
+                turnRateMeasureStop();
                 break;
             case BEACON_TRIGGERED:
                 if(ThisEvent.EventParam)
                 {
-                    ES_Timer_InitTimer(TIMER_180, TIMER_180_TICKS);
+                    turnAngle = 180;
                     nextState = TankTurn;
                     makeTransition = TRUE;
                     ThisEvent.EventType = ES_NO_EVENT;
@@ -183,7 +241,7 @@ ES_Event RunAmmoSearchSubHSM(ES_Event ThisEvent)
                     nextState = Backward;
                     makeTransition = TRUE;
                     ThisEvent.EventType = ES_NO_EVENT;
-                    ES_Timer_InitTimer(MEDIUM_HSM_TIMER, MEDIUM_TIMER_TICKS);
+                    maneuverTimerStart(MEDIUM_HSM_TIMER, MEDIUM_TIMER_TICKS);
                 }
                 break;
             case TW_TRIGGERED:
@@ -193,7 +251,7 @@ ES_Event RunAmmoSearchSubHSM(ES_Event ThisEvent)
                     makeTransition = TRUE;
                     ThisEvent.EventType = ES_NO_EVENT;
                     // because we were almost falling off the field
-                    ES_Timer_InitTimer(LONG_HSM_TIMER, MEDIUM_TIMER_TICKS);
+                    maneuverTimerStart(LONG_HSM_TIMER, MEDIUM_TIMER_TICKS);
                 }
                 break;
             case ES_TIMEOUT:
@@ -208,7 +266,7 @@ ES_Event RunAmmoSearchSubHSM(ES_Event ThisEvent)
                 if(ThisEvent.EventParam == LONG_HSM_TIMER)
                 {
                     forwardTimeoutFlag = TRUE;
-                    ES_Timer_InitTimer(TIMER_90, TIMER_90_TICKS);
+                    turnAngle = 90;
                     nextState = TankTurnAvoid;
                     makeTransition = TRUE;
                     ThisEvent.EventType = ES_NO_EVENT;
@@ -223,31 +281,20 @@ ES_Event RunAmmoSearchSubHSM(ES_Event ThisEvent)
     case TankTurnAvoid:
         switch (ThisEvent.EventType) { 
             case ES_ENTRY:
-                if (turnParam == RIGHT){
-                    tankTurnRight();
-                }else{
-                    tankTurnLeft();
-                }
+                turnByAngle((turnParam == RIGHT) ? -turnAngle : turnAngle);
                 break;
-            case ES_TIMEOUT:
-                if (ThisEvent.EventParam == TIMER_45 || ThisEvent.EventParam == TIMER_22 || ThisEvent.EventParam == TIMER_360
-                        || ThisEvent.EventParam == TIMER_180 || ThisEvent.EventParam == TIMER_90){
-                    if (forwardTimeoutFlag)
-                    {
-                        forwardTimeoutFlag = FALSE;
-                        ES_Timer_InitTimer(LONG_HSM_TIMER, 2.5*LONG_TIMER_TICKS); 
-                    }
-                    nextState = Forward;
-                    makeTransition = TRUE;
-                    ThisEvent.EventType = ES_NO_EVENT;
+            case TURN_DONE:
+                if (forwardTimeoutFlag)
+                {
+                    forwardTimeoutFlag = FALSE;
+                    ES_Timer_InitTimer(LONG_HSM_TIMER, 2.5*LONG_TIMER_TICKS); 
                 }
+                nextState = Forward;
+                makeTransition = TRUE;
+                ThisEvent.EventType = ES_NO_EVENT;
                 break;
             case ES_EXIT:
-                ES_Timer_StopTimer(TIMER_22);
-                ES_Timer_StopTimer(TIMER_45);
-                ES_Timer_StopTimer(TIMER_90);
-                ES_Timer_StopTimer(TIMER_180);
-                ES_Timer_StopTimer(TIMER_360);
+                turnStop();
                 break;
             case ES_NO_EVENT:
             default:
@@ -258,11 +305,7 @@ ES_Event RunAmmoSearchSubHSM(ES_Event ThisEvent)
     case TankTurn:
         switch (ThisEvent.EventType) {  
             case ES_ENTRY:
-                if (turnParam == RIGHT){
-                    tankTurnRight();
-                }else{
-                    tankTurnLeft();
-                }
+                turnByAngle((turnParam == RIGHT) ? -turnAngle : turnAngle);
                 break;
             case TAPE_TRIGGERED:
                 // If tape is triggered after hitting a track wire and we weren't following it, back up a lot
@@ -298,20 +341,13 @@ ES_Event RunAmmoSearchSubHSM(ES_Event ThisEvent)
                     ThisEvent.EventType = ES_NO_EVENT;
                 }
                 break;
-            case ES_TIMEOUT:
-                if (ThisEvent.EventParam == TIMER_45 || ThisEvent.EventParam == TIMER_22 || ThisEvent.EventParam == TIMER_360
-                        || ThisEvent.EventParam == TIMER_180){
-                    nextState = Forward;
-                    makeTransition = TRUE;
-                    ThisEvent.EventType = ES_NO_EVENT;
-                }
+            case TURN_DONE:
+                nextState = Forward;
+                makeTransition = TRUE;
+                ThisEvent.EventType = ES_NO_EVENT;
                 break;
             case ES_EXIT:
-                ES_Timer_StopTimer(TIMER_22);
-                ES_Timer_StopTimer(TIMER_45);
-                ES_Timer_StopTimer(TIMER_90);
-                ES_Timer_StopTimer(TIMER_180);
-                ES_Timer_StopTimer(TIMER_360);
+                turnStop();
                 break;
             case ES_NO_EVENT:
             default:
@@ -325,57 +361,28 @@ ES_Event RunAmmoSearchSubHSM(ES_Event ThisEvent)
                 ES_Timer_InitTimer(LONG_HSM_TIMER, 2.5*LONG_TIMER_TICKS);
                 if (turnParam == RIGHT){
                     tapeSide = LEFT;
-                    tankTurnRight();
                 }else{
                     tapeSide = RIGHT;    
-                    tankTurnLeft();
+                }
+                // Keep going until the other front corner crosses too, the time
+                // between the two gives the angle to turn along the tape in one go
+                if (getTapeApproachAngle(&approachAngle)){
+                    turnByAngle((turnParam == RIGHT) ? approachAngle - 90 : approachAngle + 90);
+                }else{
+                    moveForward();
+                    maneuverTimerStart(MEDIUM_HSM_TIMER, MEDIUM_TIMER_TICKS);
                 }
                 break;
             case TAPE_TRIGGERED:           
-                if(!(ThisEvent.EventParam & TS_FR) && (turnParam == LEFT) && !(ThisEvent.EventParam & TS_FL)){
-                    ES_Timer_InitTimer(LONG_HSM_TIMER, 3.5*LONG_TIMER_TICKS);
-                    turnParam = RIGHT;
-                    gradualTurnRight(10);
-                    makeTransition = TRUE;
-                    nextState = FollowTape;
-                    ThisEvent.EventType = ES_NO_EVENT;
-                } else if(!(ThisEvent.EventParam & TS_FL) && (turnParam == RIGHT) && !(ThisEvent.EventParam & TS_FR)){
-                    ES_Timer_InitTimer(LONG_HSM_TIMER, 3.5*LONG_TIMER_TICKS);
-                    turnParam = LEFT;
-                    gradualTurnLeft(10);
-                    makeTransition = TRUE;
-                    nextState = FollowTape;
-                    ThisEvent.EventType = ES_NO_EVENT;
-                }
-                
-                if((ThisEvent.EventParam & TS_FR) && (turnParam == RIGHT)){
-                    if (tapeSide == RIGHT)
-                    {
-                        turnParam = LEFT;
-                    }
-                    else
-                    {
-                        turnParam = RIGHT;
-                    }
-                    nextState = TankTurnAvoid;
-                    makeTransition = TRUE;
-                    ThisEvent.EventType = ES_NO_EVENT;
-                    ES_Timer_InitTimer(TIMER_180, TIMER_180_TICKS);
-                } else if((ThisEvent.EventParam & TS_FL) && (turnParam == LEFT)){
-                    if (tapeSide == RIGHT)
-                    {
-                        turnParam = LEFT;
-                    }
-                    else
-                    {
-                        turnParam = RIGHT;
-                    }
-                    nextState = TankTurnAvoid;
-                    makeTransition = TRUE;
-                    ThisEvent.EventType = ES_NO_EVENT;
-                    ES_Timer_InitTimer(TIMER_180, TIMER_180_TICKS);
+                if (!turnRunning() && getTapeApproachAngle(&approachAngle)){
+                    ES_Timer_StopTimer(MEDIUM_HSM_TIMER);
+                    turnByAngle((turnParam == RIGHT) ? approachAngle - 90 : approachAngle + 90);
                 }
-                
+                break;
+            case TURN_DONE:
+                nextState = FollowTape;
+                makeTransition = TRUE;
+                ThisEvent.EventType = ES_NO_EVENT;
                 break;
             case BUMPED:
                 // We kinda want to ignore back bumpers when going forward, who cares if a robot hit us
@@ -392,18 +399,28 @@ ES_Event RunAmmoSearchSubHSM(ES_Event ThisEvent)
                     nextState = Backward;
                     makeTransition = TRUE;
                     ThisEvent.EventType = ES_NO_EVENT;
-                    ES_Timer_InitTimer(MEDIUM_HSM_TIMER, MEDIUM_TIMER_TICKS);
+                    maneuverTimerStart(MEDIUM_HSM_TIMER, MEDIUM_TIMER_TICKS);
                 }
                 break;
             case ES_TIMEOUT:
                 if (ThisEvent.EventParam == LONG_HSM_TIMER)
                 {
+                    ES_Timer_StopTimer(MEDIUM_HSM_TIMER);
                     nextState = Forward;
                     makeTransition = TRUE;
                     ThisEvent.EventType = ES_NO_EVENT;
                 }
+                else if (ThisEvent.EventParam == MEDIUM_HSM_TIMER && !turnRunning())
+                {
+                    // The other corner never got there, we came in nearly along
+                    // the tape already
+                    nextState = FollowTape;
+                    makeTransition = TRUE;
+                    ThisEvent.EventType = ES_NO_EVENT;
+                }
                 break;
             case ES_EXIT:
+                turnStop();
                 break;
             case ES_NO_EVENT:
             default:
@@ -413,17 +430,15 @@ ES_Event RunAmmoSearchSubHSM(ES_Event ThisEvent)
         
     case FollowTape:
         switch(ThisEvent.EventType){
-            case TAPE_TRIGGERED:
-                ES_Timer_StopTimer(LONG_HSM_TIMER); // If we get another tape event then the sharp gradual turn worked!
-                ES_Timer_InitTimer(MEDIUM_HSM_TIMER, MEDIUM_TIMER_TICKS);
-
-                if(!(ThisEvent.EventParam & TS_FR) && (turnParam == LEFT)){
-                    turnParam = RIGHT;
-                    gradualTurnRight(20);
-                } else if(!(ThisEvent.EventParam & TS_FL) && (turnParam == RIGHT)){
-                    turnParam = LEFT;
-                    gradualTurnLeft(20);
-                }                
+            case ES_ENTRY:
+                // The PID in TapeFollow steers from here on, it runs off every tape frame
+                ES_Timer_StopTimer(LONG_HSM_TIMER);
+                tapeFollowStart(tapeSide);
+                break;
+            case TAPE_LOST:
+                nextState = Forward;
+                makeTransition = TRUE;
+                ThisEvent.EventType = ES_NO_EVENT;
                 break;
             case BUMPED:
                 // We kinda want to ignore back bumpers when going forward, who cares if a robot hit us
@@ -440,18 +455,11 @@ ES_Event RunAmmoSearchSubHSM(ES_Event ThisEvent)
                     nextState = Backward;
                     makeTransition = TRUE;
                     ThisEvent.EventType = ES_NO_EVENT;
-                    ES_Timer_InitTimer(MEDIUM_HSM_TIMER, MEDIUM_TIMER_TICKS);
+                    maneuverTimerStart(MEDIUM_HSM_TIMER, MEDIUM_TIMER_TICKS);
                 }
                 break;
-            case ES_TIMEOUT:
-                if(ThisEvent.EventParam == LONG_HSM_TIMER || ThisEvent.EventParam == MEDIUM_HSM_TIMER)
-                {
-                    nextState = Forward;
-                    makeTransition = TRUE;
-                    ThisEvent.EventType = ES_NO_EVENT;
-                } 
-                break;
             case ES_EXIT:
+                tapeFollowStop();
                 break;
             case ES_NO_EVENT:
             default:
@@ -466,17 +474,16 @@ ES_Event RunAmmoSearchSubHSM(ES_Event ThisEvent)
                 break;
             case ES_TIMEOUT:
                 if(ThisEvent.EventParam == MEDIUM_HSM_TIMER){
+                    turnAngle = 22;
                     nextState = TankTurnAvoid;
                     makeTransition = TRUE;
                     ThisEvent.EventType = ES_NO_EVENT;
-                    ES_Timer_InitTimer(TIMER_45, TIMER_45_TICKS/2);
                 }
                 if(ThisEvent.EventParam == LONG_HSM_TIMER){
-                    ES_Timer_InitTimer(TIMER_180, TIMER_180_TICKS);
+                    turnAngle = 22;
                     nextState = TankTurn;
                     makeTransition = TRUE;
                     ThisEvent.EventType = ES_NO_EVENT;
-                    ES_Timer_InitTimer(TIMER_22, TIMER_22_TICKS);
                 }
                 break;
             /*case TAPE_TRIGGERED:
@@ -18,6 +18,10 @@
 #include "FirstTargetSearchSubHSM.h"
 #include "sensors.h"
 #include "motor.h"
+#include "TurnControl.h"
+#include "MissionMemory.h"
+#include "ManeuverTimer.h"
+#include "InputSampling.h"
 
 /*******************************************************************************
  * PRIVATE #DEFINES                                                            *
@@ -25,6 +29,7 @@
 
 #define LEFT 0
 #define RIGHT 1
+#define SCAN_STEP 22 // degrees the beacon sweep widens by each pass
 
 /*******************************************************************************
  * MODULE #DEFINES                                                             *
@@ -32,6 +37,7 @@
 
 typedef enum {
     InitPState,
+    DirectApproach,
     ForwardScan,
     Scan,
     Forward,
@@ -42,6 +48,7 @@ typedef enum {
 
 static const char *StateNames[] = {
 	"InitPState",
+	"DirectApproach",
 	"ForwardScan",
 	"Scan",
 	"Forward",
@@ -104,8 +111,10 @@ ES_Event RunFirstTargetSearchSubHSM(ES_Event ThisEvent)
 {
     uint8_t makeTransition = FALSE; // use to flag transition
     HSMState_t nextState; // <- change type to correct enum
-    static uint16_t scanTimer = TIMER_22_TICKS;
+    static int16_t scanAngle = SCAN_STEP;
     static uint8_t turnParam;
+    static uint8_t centering = FALSE; // turning back to the middle of the beacon
+    uint16_t beaconHeading;
 
     ES_Tattle(); // trace call stack
 
@@ -113,7 +122,7 @@ ES_Event RunFirstTargetSearchSubHSM(ES_Event ThisEvent)
     case InitPState: // If current state is initial Pseudo State
         if (ThisEvent.EventType == ES_INIT)// only respond to ES_Init
         {
-            nextState = ForwardScan;
+            nextState = missionRemembered(MISSION_FIRST_TARGET) ? DirectApproach : ForwardScan;
             makeTransition = TRUE;
             ThisEvent.EventType = ES_NO_EVENT;
             //ES_Timer_InitTimer(LONG_HSM_TIMER,3*LONG_TIMER_TICKS);
@@ -121,49 +130,88 @@ ES_Event RunFirstTargetSearchSubHSM(ES_Event ThisEvent)
         }
         break;
 
-    case ForwardScan:
+    case DirectApproach:
         switch(ThisEvent.EventType) {
             case ES_ENTRY:
-                if(turnParam == RIGHT)
+                missionApproachStart(MISSION_FIRST_TARGET);
+                break;
+            case TAPE_TRIGGERED:
+                // tape with the beacon on is the target, the top level takes that
+                if(ThisEvent.EventParam & TS_FR && !getBeaconVal())
                 {
-                    tankTurnRight();
-                    ES_Timer_InitTimer(TIMER_22,scanTimer);
-                    turnParam = LEFT;
+                    lastBump = RIGHT;
+                    nextState = Backward;
+                    makeTransition = TRUE;
+                    ThisEvent.EventType = ES_NO_EVENT;
                 }
-                else
-                {    
-                    tankTurnLeft();
-                    ES_Timer_InitTimer(TIMER_22,scanTimer);
-                    turnParam = RIGHT;
+                else if(ThisEvent.EventParam & TS_FL && !getBeaconVal())
+                {
+                    lastBump = LEFT;
+                    nextState = Backward;
+                    makeTransition = TRUE;
+                    ThisEvent.EventType = ES_NO_EVENT;
                 }
                 break;
-            case BEACON_TRIGGERED:
-                if(ThisEvent.EventParam)
+            case BUMPED:
+                if(ThisEvent.EventParam & (FL_BUMPER | FR_BUMPER))
                 {
-                    scanTimer = TIMER_22_TICKS;
-                    nextState = Forward;
+                    lastBump = (ThisEvent.EventParam & FL_BUMPER) ? LEFT : RIGHT;
+                    nextState = Backward;
                     makeTransition = TRUE;
                     ThisEvent.EventType = ES_NO_EVENT;
-                    ES_Timer_StopTimer(TIMER_22);
                 }
                 break;
-            case ES_TIMEOUT:
-                if(ThisEvent.EventParam == TIMER_22)
+            case APPROACH_DONE:
+                if(ThisEvent.EventParam == APPROACH_FAILED)
                 {
-                    scanTimer = scanTimer + TIMER_22_TICKS;
-                    if(turnParam == RIGHT)
-                    {
-                        tankTurnRight();
-                        ES_Timer_InitTimer(TIMER_22,scanTimer);
-                        turnParam = LEFT;
-                    }
-                    else
-                    {    
-                        tankTurnLeft();
-                        ES_Timer_InitTimer(TIMER_22,scanTimer);
-                        turnParam = RIGHT;
-                    }
+                    missionForget(MISSION_FIRST_TARGET);
                 }
+                nextState = ForwardScan;
+                makeTransition = TRUE;
+                ThisEvent.EventType = ES_NO_EVENT;
+                break;
+            case ES_EXIT:
+                missionApproachStop();
+                break;
+            case ES_NO_EVENT:
+            default:
+                break;
+        }
+        break;
+
+    case ForwardScan:
+        switch(ThisEvent.EventType) {
+            case ES_ENTRY:
+                // sweep back and forth, a little wider each time
+                centering = FALSE;
+                beaconBearingReset(); // drop a lobe or a rise from before
+                turnByAngle((turnParam == RIGHT) ? -scanAngle : scanAngle);
+                turnParam = (turnParam == RIGHT) ? LEFT : RIGHT;
+                break;
+            case BEACON_TRIGGERED:
+                // sweep on through the lobe, then turn back to its middle
+                if(!ThisEvent.EventParam && !centering && getBeaconBearing(&beaconHeading))
+                {
+                    centering = TRUE;
+                    missionBeaconSighted(MISSION_FIRST_TARGET, &beaconHeading);
+                    turnToHeading(beaconHeading);
+                }
+                break;
+            case TURN_DONE:
+                if (centering || getBeaconVal())
+                {
+                    scanAngle = SCAN_STEP;
+                    nextState = Forward;
+                    makeTransition = TRUE;
+                    ThisEvent.EventType = ES_NO_EVENT;
+                    break;
+                }
+                scanAngle = scanAngle + SCAN_STEP;
+                turnByAngle((turnParam == RIGHT) ? -scanAngle : scanAngle);
+                turnParam = (turnParam == RIGHT) ? LEFT : RIGHT;
+                break;
+            case ES_EXIT:
+                turnStop();
                 break;
             case ES_NO_EVENT:
             default:
@@ -241,7 +289,7 @@ ES_Event RunFirstTargetSearchSubHSM(ES_Event ThisEvent)
         switch(ThisEvent.EventType){
             case ES_ENTRY:
                 moveBackward();
-                ES_Timer_InitTimer(MEDIUM_HSM_TIMER, MEDIUM_TIMER_TICKS);
+                maneuverTimerStart(MEDIUM_HSM_TIMER, MEDIUM_TIMER_TICKS);
                 break;
             case ES_TIMEOUT:
                 if(ThisEvent.EventParam == MEDIUM_HSM_TIMER)
@@ -249,7 +297,6 @@ ES_Event RunFirstTargetSearchSubHSM(ES_Event ThisEvent)
                     nextState = TankTurn;
                     makeTransition = TRUE;
                     ThisEvent.EventType = ES_NO_EVENT;
-                    ES_Timer_InitTimer(TIMER_45, TIMER_45_TICKS);
                 }
                 break;
             case ES_EXIT:
@@ -260,24 +307,17 @@ ES_Event RunFirstTargetSearchSubHSM(ES_Event ThisEvent)
     case TankTurn:
         switch (ThisEvent.EventType) {  
             case ES_ENTRY:
-                if(lastBump == RIGHT)
-                {
-                    tankTurnLeft();
-                }
-                else
-                {
-                    tankTurnRight();
-                }
+                // turn away from whatever we hit
+                turnByAngle((lastBump == RIGHT) ? 45 : -45);
                 break;
-            case ES_TIMEOUT:
-                if(ThisEvent.EventParam == TIMER_45){
-                    nextState = Forward;
-                    makeTransition  = TRUE;
-                    ThisEvent.EventType = ES_NO_EVENT;
-                    ES_Timer_InitTimer(SCAN_TIMER, SCAN_TIMER_TICKS);
-                }
+            case TURN_DONE:
+                nextState = Forward;
+                makeTransition  = TRUE;
+                ThisEvent.EventType = ES_NO_EVENT;
+                ES_Timer_InitTimer(SCAN_TIMER, SCAN_TIMER_TICKS);
                 break;
             case ES_EXIT:
+                turnStop();
                 break;
             default:
                 break;
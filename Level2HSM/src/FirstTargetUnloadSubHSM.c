@@ -19,6 +19,10 @@
 #include "sensors.h"
 #include "motor.h"
 #include "LED.h"
+#include "ManeuverTimer.h"
+#include "SyncSampling.h"
+#include "TurnControl.h"
+#include "ServoMotion.h"
 
 /*******************************************************************************
  * PRIVATE #DEFINES                                                            *
@@ -66,7 +70,6 @@ static const char *StateNames[] = {
 
 static HSMState_t CurrentState = InitPState; // <- change enum name to match ENUM
 static uint8_t MyPriority;
-static uint16_t servoPulse = UNLOADING_CENTER_PULSE;
 static uint8_t shimmy = LEFT;
 static uint8_t shimmyCount = 0;
 static uint8_t unloaded = FALSE;
@@ -107,6 +110,7 @@ uint8_t InitFirstTargetUnloadSubHSM(void)
 ES_Event RunFirstTargetUnloadSubHSM(ES_Event ThisEvent)
 {
     static uint8_t turnParam;
+    int16_t approachAngle;
     uint8_t makeTransition = FALSE; // use to flag transition
     HSMState_t nextState; // <- change type to correct enum
 
@@ -132,10 +136,12 @@ ES_Event RunFirstTargetUnloadSubHSM(ES_Event ThisEvent)
     case AlignToTape:
         switch (ThisEvent.EventType) {  
             case ES_ENTRY:
-                if (turnParam == RIGHT){
-                    tankTurnRight();
-                } else if (turnParam == LEFT){
-                    tankTurnLeft();
+                // Keep going until the other front corner crosses too, the time
+                // between the two gives the turn that squares us up to the tape
+                if (getTapeApproachAngle(&approachAngle)){
+                    turnByAngle(approachAngle);
+                } else {
+                    maneuverTimerStart(MEDIUM_HSM_TIMER, MEDIUM_TIMER_TICKS);
                 }
                 break;
             case TAPE_TRIGGERED:
@@ -145,6 +151,11 @@ ES_Event RunFirstTargetUnloadSubHSM(ES_Event ThisEvent)
                     makeTransition = TRUE;
                     ThisEvent.EventParam = ES_NO_EVENT;
                 }
+                else if (!turnRunning() && getTapeApproachAngle(&approachAngle))
+                {
+                    ES_Timer_StopTimer(MEDIUM_HSM_TIMER);
+                    turnByAngle(approachAngle);
+                }
                 else if((ThisEvent.EventParam & TS_FL) &&  (turnParam == RIGHT))
                 {
                     moveForward();
@@ -156,6 +167,25 @@ ES_Event RunFirstTargetUnloadSubHSM(ES_Event ThisEvent)
                     setMoveSpeed(10);
                 }
                 break;
+            case TURN_DONE:
+                // square to the tape, creep up until the middle sensor is on it
+                moveForward();
+                setMoveSpeed(10);
+                break;
+            case ES_TIMEOUT:
+                if (ThisEvent.EventParam == MEDIUM_HSM_TIMER && !turnRunning())
+                {
+                    // the other corner never got there, turn onto it instead
+                    if (turnParam == RIGHT){
+                        tankTurnRight();
+                    } else if (turnParam == LEFT){
+                        tankTurnLeft();
+                    }
+                }
+                break;
+            case ES_EXIT:
+                turnStop();
+                break;
             case ES_NO_EVENT:
             default:
                 break;
@@ -228,27 +258,13 @@ ES_Event RunFirstTargetUnloadSubHSM(ES_Event ThisEvent)
         switch (ThisEvent.EventType) {
             case ES_ENTRY:
                 stopMoving();
-                ES_Timer_InitTimer(SERVO_TIMER,SERVO_TIMER_TICKS);
-                setPulseBridgeServo(BRIDGE_OUT_PULSE);
-                setPulseUnloadingServo(servoPulse);
+                servoMotionSet(SERVO_BRIDGE, BRIDGE_OUT_PULSE);
+                servoMotionStart(SERVO_UNLOADING, UNLOADING_HIGH_PULSE, UNLOAD_HIGH_SLEW_MS, UNLOAD_HOLD_MS);
                 break;
-            case ES_TIMEOUT:
-                if (ThisEvent.EventParam == SERVO_TIMER)
+            case SERVO_DONE:
+                if (ThisEvent.EventParam == SERVO_UNLOADING)
                 {
-                    if (servoPulse < UNLOADING_HIGH_PULSE)
-                    {
-                        ES_Timer_InitTimer(SERVO_TIMER,SERVO_TIMER_TICKS);
-                        servoPulse+=10;
-                        setPulseUnloadingServo(servoPulse);
-                    } else {
-                        ES_Timer_InitTimer(LONG_HSM_TIMER,2.5*LONG_TIMER_TICKS);
-                    }
-                    
-                }
-                else if(ThisEvent.EventParam == LONG_HSM_TIMER)
-                {
-                    servoPulse = UNLOADING_CENTER_PULSE;
-                    setPulseUnloadingServo(servoPulse);
+                    servoMotionSet(SERVO_UNLOADING, UNLOADING_CENTER_PULSE);
                     nextState = Shimmy;
                     makeTransition = TRUE;
                     ThisEvent.EventType = ES_NO_EVENT;
@@ -266,7 +282,7 @@ ES_Event RunFirstTargetUnloadSubHSM(ES_Event ThisEvent)
         switch (ThisEvent.EventType) {
             case ES_ENTRY:
                 moveBackward();
-                ES_Timer_InitTimer(LONG_HSM_TIMER,MEDIUM_TIMER_TICKS);
+                maneuverTimerStart(LONG_HSM_TIMER,MEDIUM_TIMER_TICKS);
                 break;
             case TAPE_TRIGGERED:
                 /*if(ThisEvent.EventParam & TS_BR || ThisEvent.EventParam & TS_BL)
@@ -299,15 +315,13 @@ ES_Event RunFirstTargetUnloadSubHSM(ES_Event ThisEvent)
     case TankTurn:
         switch (ThisEvent.EventType) {
             case ES_ENTRY:
-                tankTurnLeft();
-                ES_Timer_InitTimer(TIMER_90,TIMER_90_TICKS);
+                turnByAngle(90);
                 break;
-            case ES_TIMEOUT:
-                if(ThisEvent.EventParam == TIMER_90 /*&& unloaded == TRUE*/)
-                {
-                    ThisEvent.EventType = UNLOADED;
-                }
-               
+            case TURN_DONE:
+                ThisEvent.EventType = UNLOADED;
+                break;
+            case ES_EXIT:
+                turnStop();
                 break;
         }
         break;
@@ -339,7 +353,7 @@ ES_Event RunFirstTargetUnloadSubHSM(ES_Event ThisEvent)
                     nextState = Backward;
                     makeTransition = TRUE;
                     ThisEvent.EventType = ES_NO_EVENT;
-                    ES_Timer_InitTimer(MEDIUM_HSM_TIMER,MEDIUM_TIMER_TICKS);
+                    maneuverTimerStart(MEDIUM_HSM_TIMER,MEDIUM_TIMER_TICKS);
                     //unloaded = TRUE;
                 }
                 break;
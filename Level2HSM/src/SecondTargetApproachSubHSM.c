@@ -18,7 +18,11 @@
 #include "SecondTargetApproachSubHSM.h"
 #include "sensors.h"
 #include "motor.h"
+#include "TurnControl.h"
 #include "IO_Ports.h"
+#include "ManeuverTimer.h"
+#include "InputSampling.h"
+#include "MissionMemory.h"
 
 /*******************************************************************************
  * PRIVATE #DEFINES                                                            *
@@ -26,6 +30,7 @@
 
 #define LEFT 1
 #define RIGHT 0
+#define SCAN_STEP 22 // degrees the beacon sweep widens by each pass
 
 /*******************************************************************************
  * MODULE #DEFINES                                                             *
@@ -102,8 +107,10 @@ ES_Event RunSecondTargetApproachSubHSM(ES_Event ThisEvent)
 {
     uint8_t makeTransition = FALSE; 
     HSMState_t nextState; 
-    static uint16_t scanTimer = TIMER_22_TICKS;
+    static int16_t scanAngle = SCAN_STEP;
     static uint8_t turnParam;
+    static uint8_t centering = FALSE; // turning back to the middle of the beacon
+    uint16_t beaconHeading;
 
     ES_Tattle(); // trace call stack
 
@@ -120,43 +127,36 @@ ES_Event RunSecondTargetApproachSubHSM(ES_Event ThisEvent)
     case ForwardScan:
         switch(ThisEvent.EventType) {
             case ES_ENTRY:
-                if(turnParam == RIGHT)
-                {
-                    tankTurnRight();
-                    ES_Timer_InitTimer(TIMER_22,scanTimer);
-                    turnParam = LEFT;
-                }
-                else
-                {    
-                    tankTurnLeft();
-                    ES_Timer_InitTimer(TIMER_22,scanTimer);
-                    turnParam = RIGHT;
-                }
+                // sweep back and forth, a little wider each time
+                centering = FALSE;
+                beaconBearingReset(); // drop a lobe or a rise from before
+                turnByAngle((turnParam == RIGHT) ? -scanAngle : scanAngle);
+                turnParam = (turnParam == RIGHT) ? LEFT : RIGHT;
                 break;
             case BEACON_TRIGGERED:
-                scanTimer = TIMER_22_TICKS;
-                nextState = Forward;
-                makeTransition = TRUE;
-                ThisEvent.EventType = ES_NO_EVENT;
-                ES_Timer_StopTimer(TIMER_22);
+                // sweep on through the lobe, then turn back to its middle
+                if(!ThisEvent.EventParam && !centering && getBeaconBearing(&beaconHeading))
+                {
+                    centering = TRUE;
+                    missionBeaconSighted(MISSION_SECOND_TARGET, &beaconHeading);
+                    turnToHeading(beaconHeading);
+                }
                 break;
-            case ES_TIMEOUT:
-                if(ThisEvent.EventParam == TIMER_22)
+            case TURN_DONE:
+                if (centering || getBeaconVal())
                 {
-                    scanTimer = scanTimer + TIMER_22_TICKS;
-                    if(turnParam == RIGHT)
-                    {
-                        tankTurnRight();
-                        ES_Timer_InitTimer(TIMER_22,scanTimer);
-                        turnParam = LEFT;
-                    }
-                    else
-                    {    
-                        tankTurnLeft();
-                        ES_Timer_InitTimer(TIMER_22,scanTimer);
-                        turnParam = RIGHT;
-                    }
+                    scanAngle = SCAN_STEP;
+                    nextState = Forward;
+                    makeTransition = TRUE;
+                    ThisEvent.EventType = ES_NO_EVENT;
+                    break;
                 }
+                scanAngle = scanAngle + SCAN_STEP;
+                turnByAngle((turnParam == RIGHT) ? -scanAngle : scanAngle);
+                turnParam = (turnParam == RIGHT) ? LEFT : RIGHT;
+                break;
+            case ES_EXIT:
+                turnStop();
                 break;
             case ES_NO_EVENT:
             default:
@@ -177,7 +177,7 @@ ES_Event RunSecondTargetApproachSubHSM(ES_Event ThisEvent)
                     nextState = Backward;
                     makeTransition = TRUE;
                     ThisEvent.EventType = ES_NO_EVENT;  
-                    ES_Timer_InitTimer(MEDIUM_HSM_TIMER, MEDIUM_TIMER_TICKS);
+                    maneuverTimerStart(MEDIUM_HSM_TIMER, MEDIUM_TIMER_TICKS);
                 }
                 else if(ThisEvent.EventParam & TS_FL && !getBeaconVal())
                 {
@@ -185,7 +185,7 @@ ES_Event RunSecondTargetApproachSubHSM(ES_Event ThisEvent)
                     nextState = Backward;
                     makeTransition = TRUE;
                     ThisEvent.EventType = ES_NO_EVENT;
-                    ES_Timer_InitTimer(MEDIUM_HSM_TIMER, MEDIUM_TIMER_TICKS);
+                    maneuverTimerStart(MEDIUM_HSM_TIMER, MEDIUM_TIMER_TICKS);
                 }
                 break;
                 
@@ -201,7 +201,7 @@ ES_Event RunSecondTargetApproachSubHSM(ES_Event ThisEvent)
                 makeTransition = TRUE;
                 ThisEvent.EventType = ES_NO_EVENT;
 
-                ES_Timer_InitTimer(MEDIUM_HSM_TIMER, MEDIUM_TIMER_TICKS);
+                maneuverTimerStart(MEDIUM_HSM_TIMER, MEDIUM_TIMER_TICKS);
 
                 break;
             case BEACON_TRIGGERED:
@@ -258,7 +258,7 @@ ES_Event RunSecondTargetApproachSubHSM(ES_Event ThisEvent)
                 {
                     tankTurnRight();
                 }
-                ES_Timer_InitTimer(MEDIUM_HSM_TIMER, MEDIUM_TIMER_TICKS);
+                maneuverTimerStart(MEDIUM_HSM_TIMER, MEDIUM_TIMER_TICKS);
                 
                 break;
             case ES_TIMEOUT:
@@ -279,6 +279,8 @@ ES_Event RunSecondTargetApproachSubHSM(ES_Event ThisEvent)
     case Scan:
         switch(ThisEvent.EventType){
             case ES_ENTRY:
+                centering = FALSE;
+                beaconBearingReset(); // drop a lobe or a rise from before
                 if(lastBump == RIGHT)
                 {
                     tankTurnRight();
@@ -290,14 +292,25 @@ ES_Event RunSecondTargetApproachSubHSM(ES_Event ThisEvent)
                 break;
 
             case BEACON_TRIGGERED:
-                if(ThisEvent.EventParam)
+                // spin on through the lobe, then turn back to its middle
+                if(!ThisEvent.EventParam && !centering && getBeaconBearing(&beaconHeading))
                 {
-                    nextState = Forward;
-                    makeTransition = TRUE;
-                    ThisEvent.EventType = ES_NO_EVENT;
+                    centering = TRUE;
+                    missionBeaconSighted(MISSION_SECOND_TARGET, &beaconHeading);
+                    turnToHeading(beaconHeading);
                 }
                 
                 break;
+
+            case TURN_DONE:
+                nextState = Forward;
+                makeTransition = TRUE;
+                ThisEvent.EventType = ES_NO_EVENT;
+                break;
+
+            case ES_EXIT:
+                turnStop();
+                break;
         }    
         break;
 
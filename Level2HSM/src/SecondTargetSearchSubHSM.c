@@ -19,6 +19,9 @@
 #include "sensors.h"
 #include "motor.h"
 #include "IO_Ports.h"
+#include "MissionMemory.h"
+#include "TurnControl.h"
+#include "ManeuverTimer.h"
 /*******************************************************************************
  * PRIVATE #DEFINES                                                            *
  ******************************************************************************/
@@ -32,6 +35,7 @@
 
 typedef enum {
     InitPState,
+    DirectApproach,
     Backward,
     TankTurn,
     GradualTurn,
@@ -40,6 +44,7 @@ typedef enum {
 
 static const char *StateNames[] = {
 	"InitPState",
+	"DirectApproach",
 	"Backward",
 	"TankTurn",
 	"GradualTurn",
@@ -112,12 +117,52 @@ ES_Event RunSecondTargetSearchSubHSM(ES_Event ThisEvent)
     case InitPState: // If current state is initial Pseudo State
         if (ThisEvent.EventType == ES_INIT)// only respond to ES_Init
         {
-            nextState = GradualTurn;
+            nextState = missionRemembered(MISSION_SECOND_TARGET) ? DirectApproach : GradualTurn;
             makeTransition = TRUE;
             ThisEvent.EventType = ES_NO_EVENT;
         }
         break;
 
+    case DirectApproach:
+        switch(ThisEvent.EventType){
+            case ES_ENTRY:
+                missionApproachStart(MISSION_SECOND_TARGET);
+                break;
+            case TAPE_TRIGGERED:
+                if(ThisEvent.EventParam & (TS_FL | TS_FR | TS_FM))
+                {
+                    nextState = Backward;
+                    makeTransition = TRUE;
+                    ThisEvent.EventType = ES_NO_EVENT;
+                    maneuverTimerStart(MEDIUM_HSM_TIMER, MEDIUM_TIMER_TICKS);
+                }
+                break;
+            case BUMPED:
+                if(ThisEvent.EventParam & (FL_BUMPER | FR_BUMPER))
+                {
+                    nextState = Backward;
+                    makeTransition = TRUE;
+                    ThisEvent.EventType = ES_NO_EVENT;
+                    maneuverTimerStart(MEDIUM_HSM_TIMER, MEDIUM_TIMER_TICKS);
+                }
+                break;
+            case APPROACH_DONE:
+                if(ThisEvent.EventParam == APPROACH_FAILED)
+                {
+                    missionForget(MISSION_SECOND_TARGET);
+                }
+                nextState = GradualTurn;
+                makeTransition = TRUE;
+                ThisEvent.EventType = ES_NO_EVENT;
+                break;
+            case ES_EXIT:
+                missionApproachStop();
+                break;
+            default:
+                break;
+        }
+        break;
+
     case Backward:
         switch(ThisEvent.EventType){
             case ES_ENTRY:
@@ -129,7 +174,6 @@ ES_Event RunSecondTargetSearchSubHSM(ES_Event ThisEvent)
                     nextState = TankTurn;
                     makeTransition = TRUE;
                     ThisEvent.EventType = ES_NO_EVENT;
-                    ES_Timer_InitTimer(TIMER_180, TIMER_180_TICKS);
                 }
                 break;
             case ES_EXIT:
@@ -142,26 +186,16 @@ ES_Event RunSecondTargetSearchSubHSM(ES_Event ThisEvent)
     case TankTurn:
         switch (ThisEvent.EventType) {  
             case ES_ENTRY:
-                if(direction == RIGHT)
-                {
-                    tankTurnRight();
-                }
-                else
-                {
-                    tankTurnLeft();
-                }
+                turnByAngle((direction == RIGHT) ? -180 : 180);
                 break;
-            case ES_TIMEOUT:
-                if(ThisEvent.EventParam & (TIMER_90 | TIMER_180)){
-                    nextState = GradualTurn;
-                    makeTransition  = TRUE;
-                    ThisEvent.EventType = ES_NO_EVENT;
-                    ES_Timer_InitTimer(TIMER_45, TIMER_45_TICKS);
-                }
+            case TURN_DONE:
+                nextState = GradualTurn;
+                makeTransition  = TRUE;
+                ThisEvent.EventType = ES_NO_EVENT;
                 break;
             case ES_EXIT:
-                ES_Timer_StopTimer(TIMER_90);
-                ES_Timer_StopTimer(TIMER_180);
+                turnStop();
+                break;
             
             default:
                 break;
@@ -183,7 +217,8 @@ ES_Event RunSecondTargetSearchSubHSM(ES_Event ThisEvent)
                     gradualTurnRight(difference);
                     direction = LEFT;
                 }
-                difference -= 3;
+                // down to a straight line, not around to 253
+                difference = (difference > 3) ? difference - 3 : 0;
   
                 break;
             case TAPE_TRIGGERED:
@@ -192,7 +227,7 @@ ES_Event RunSecondTargetSearchSubHSM(ES_Event ThisEvent)
                     nextState = Backward;
                     makeTransition = TRUE;
                     ThisEvent.EventType = ES_NO_EVENT;
-                    ES_Timer_InitTimer(MEDIUM_HSM_TIMER, MEDIUM_TIMER_TICKS);
+                    maneuverTimerStart(MEDIUM_HSM_TIMER, MEDIUM_TIMER_TICKS);
                 }
                 break;
             case BUMPED:
@@ -201,7 +236,7 @@ ES_Event RunSecondTargetSearchSubHSM(ES_Event ThisEvent)
                     nextState = Backward;
                     makeTransition = TRUE;
                     ThisEvent.EventType = ES_NO_EVENT;
-                    ES_Timer_InitTimer(MEDIUM_HSM_TIMER, MEDIUM_TIMER_TICKS);
+                    maneuverTimerStart(MEDIUM_HSM_TIMER, MEDIUM_TIMER_TICKS);
                 }
                 break;
             /*case ES_TIMEOUT:
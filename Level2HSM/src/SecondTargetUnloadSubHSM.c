@@ -19,6 +19,10 @@
 #include "sensors.h"
 #include "motor.h"
 #include "IO_Ports.h"
+#include "ManeuverTimer.h"
+#include "SyncSampling.h"
+#include "TurnControl.h"
+#include "ServoMotion.h"
 
 /*******************************************************************************
  * PRIVATE #DEFINES                                                            *
@@ -66,7 +70,6 @@ static const char *StateNames[] = {
 /* You will need MyPriority and the state variable; you may need others as well.
  * The type of state variable should match that of enum in header file. */
 
-static uint16_t servoPulse = UNLOADING_CENTER_PULSE;
 static HSMState_t CurrentState = InitPState; // <- change enum name to match ENUM
 static uint8_t MyPriority;
 
@@ -105,6 +108,7 @@ uint8_t InitSecondTargetUnloadSubHSM(void)
 ES_Event RunSecondTargetUnloadSubHSM(ES_Event ThisEvent)
 {
     static uint8_t turnParam;
+    int16_t approachAngle;
     uint8_t makeTransition = FALSE; 
     HSMState_t nextState; 
 
@@ -130,10 +134,12 @@ ES_Event RunSecondTargetUnloadSubHSM(ES_Event ThisEvent)
     case AlignToTape:
         switch (ThisEvent.EventType) {  
             case ES_ENTRY:
-                if (turnParam == RIGHT){
-                    tankTurnRight();
-                } else if (turnParam == LEFT){
-                    tankTurnLeft();
+                // Keep going until the other front corner crosses too, the time
+                // between the two gives the turn that squares us up to the tape
+                if (getTapeApproachAngle(&approachAngle)){
+                    turnByAngle(approachAngle);
+                } else {
+                    maneuverTimerStart(MEDIUM_HSM_TIMER, MEDIUM_TIMER_TICKS);
                 }
                 break;
             case TAPE_TRIGGERED:
@@ -143,6 +149,11 @@ ES_Event RunSecondTargetUnloadSubHSM(ES_Event ThisEvent)
                     makeTransition = TRUE;
                     ThisEvent.EventParam = ES_NO_EVENT;
                 }
+                else if (!turnRunning() && getTapeApproachAngle(&approachAngle))
+                {
+                    ES_Timer_StopTimer(MEDIUM_HSM_TIMER);
+                    turnByAngle(approachAngle);
+                }
                 else if((ThisEvent.EventParam & TS_FL) &&  (turnParam == RIGHT))
                 {
                     moveForward();
@@ -154,6 +165,25 @@ ES_Event RunSecondTargetUnloadSubHSM(ES_Event ThisEvent)
                     setMoveSpeed(10);
                 }
                 break;
+            case TURN_DONE:
+                // square to the tape, creep up until the middle sensor is on it
+                moveForward();
+                setMoveSpeed(10);
+                break;
+            case ES_TIMEOUT:
+                if (ThisEvent.EventParam == MEDIUM_HSM_TIMER && !turnRunning())
+                {
+                    // the other corner never got there, turn onto it instead
+                    if (turnParam == RIGHT){
+                        tankTurnRight();
+                    } else if (turnParam == LEFT){
+                        tankTurnLeft();
+                    }
+                }
+                break;
+            case ES_EXIT:
+                turnStop();
+                break;
             case ES_NO_EVENT:
             default:
                 break;
@@ -225,7 +255,7 @@ ES_Event RunSecondTargetUnloadSubHSM(ES_Event ThisEvent)
         switch (ThisEvent.EventType) {
             case ES_ENTRY:
                 moveBackward();
-                ES_Timer_InitTimer(LONG_HSM_TIMER,MEDIUM_TIMER_TICKS);
+                maneuverTimerStart(LONG_HSM_TIMER,MEDIUM_TIMER_TICKS);
                 break;
             case TAPE_TRIGGERED:
 //                if(ThisEvent.EventParam & TS_BR || ThisEvent.EventParam & TS_BL)
@@ -254,15 +284,13 @@ ES_Event RunSecondTargetUnloadSubHSM(ES_Event ThisEvent)
     case TankTurn:
         switch (ThisEvent.EventType) {
             case ES_ENTRY:
-                tankTurnLeft();
-                ES_Timer_InitTimer(TIMER_90,TIMER_90_TICKS);
+                turnByAngle(90);
                 break;
-            case ES_TIMEOUT:
-                if(ThisEvent.EventParam == TIMER_90)
-                {
-                    ThisEvent.EventType = UNLOADED;
-                }
-               
+            case TURN_DONE:
+                ThisEvent.EventType = UNLOADED;
+                break;
+            case ES_EXIT:
+                turnStop();
                 break;
         }
         break;
@@ -271,27 +299,13 @@ ES_Event RunSecondTargetUnloadSubHSM(ES_Event ThisEvent)
         switch (ThisEvent.EventType) {
             case ES_ENTRY:
                 stopMoving();
-                ES_Timer_InitTimer(SERVO_TIMER,SERVO_TIMER_TICKS);
-                setPulseBridgeServo(BRIDGE_OUT_PULSE);
-                setPulseUnloadingServo(servoPulse);
+                servoMotionSet(SERVO_BRIDGE, BRIDGE_OUT_PULSE);
+                servoMotionStart(SERVO_UNLOADING, UNLOADING_HIGH_PULSE, UNLOAD_HIGH_SLEW_MS, UNLOAD_HOLD_MS);
                 break;
-            case ES_TIMEOUT:
-                if (ThisEvent.EventParam == SERVO_TIMER)
+            case SERVO_DONE:
+                if (ThisEvent.EventParam == SERVO_UNLOADING)
                 {
-                    if (servoPulse < UNLOADING_HIGH_PULSE)
-                    {
-                        ES_Timer_InitTimer(SERVO_TIMER,SERVO_TIMER_TICKS);
-                        servoPulse+=10;
-                        setPulseUnloadingServo(servoPulse);
-                    } else {
-                        ES_Timer_InitTimer(LONG_HSM_TIMER,2.5*LONG_TIMER_TICKS);
-                    }
-                    
-                }
-                else if(ThisEvent.EventParam == LONG_HSM_TIMER)
-                {
-                    servoPulse = UNLOADING_CENTER_PULSE;
-                    setPulseUnloadingServo(servoPulse);
+                    servoMotionSet(SERVO_UNLOADING, UNLOADING_CENTER_PULSE);
                     nextState = UnloadOne;
                     makeTransition = TRUE;
                     ThisEvent.EventType = ES_NO_EVENT;
@@ -309,30 +323,16 @@ ES_Event RunSecondTargetUnloadSubHSM(ES_Event ThisEvent)
         switch (ThisEvent.EventType) {
             case ES_ENTRY:
                 stopMoving();
-                ES_Timer_InitTimer(SERVO_TIMER,SERVO_TIMER_TICKS);
-                setPulseUnloadingServo(servoPulse);
+                servoMotionStart(SERVO_UNLOADING, UNLOADING_LOW_PULSE, UNLOAD_LOW_SLEW_MS, UNLOAD_HOLD_MS);
                 break;
-            case ES_TIMEOUT:
-                if (ThisEvent.EventParam == SERVO_TIMER)
-                {
-                    if (servoPulse > UNLOADING_LOW_PULSE)
-                    {
-                        ES_Timer_InitTimer(SERVO_TIMER,SERVO_TIMER_TICKS);
-                        servoPulse-=10;
-                        setPulseUnloadingServo(servoPulse);
-                        ThisEvent.EventType = ES_NO_EVENT;
-                    } else {
-                        ES_Timer_InitTimer(LONG_HSM_TIMER,2.5*LONG_TIMER_TICKS);
-                    }
-                }
-                else if(ThisEvent.EventParam == LONG_HSM_TIMER)
+            case SERVO_DONE:
+                if (ThisEvent.EventParam == SERVO_UNLOADING)
                 {
-                    servoPulse = UNLOADING_CENTER_PULSE;
-                    setPulseUnloadingServo(servoPulse);
+                    servoMotionSet(SERVO_UNLOADING, UNLOADING_CENTER_PULSE);
                     nextState = Backward;
                     makeTransition = TRUE;
                     ThisEvent.EventType = ES_NO_EVENT;
-                    ES_Timer_InitTimer(MEDIUM_HSM_TIMER,MEDIUM_TIMER_TICKS);
+                    maneuverTimerStart(MEDIUM_HSM_TIMER,MEDIUM_TIMER_TICKS);
                 }
 //                case ES_TIMEOUT:
 //                if (ThisEvent.EventParam == SERVO_TIMER)
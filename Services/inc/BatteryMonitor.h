@@ -1,9 +1,15 @@
-// Joseph Grant
-// Midterm Problem 8
-// 11/1/16
+/*
+ * File:   BatteryMonitor.h
+ * Author: TeamPutterWorth
+ *
+ * This service keeps a filtered reading of the battery voltage in millivolts and
+ * a cached fixed point compensation factor the motor driver scales its duty
+ * cycles by. It posts BATTERY_CONNECTED/BATTERY_DISCONNECTED on the power switch.
+ *
+ */
 
-#ifndef BEACON_DEBOUNCE_H  // <- This should be changed to your own guard on both
-#define BEACON_DEBOUNCE_H  //    of these lines
+#ifndef BATTERY_MONITOR_H
+#define BATTERY_MONITOR_H
 
 
 /*******************************************************************************
@@ -16,6 +22,12 @@
  * PUBLIC #DEFINES                                                             *
  ******************************************************************************/
 
+// getBatteryCompensation() is Q12, BATTERY_COMP_ONE means no correction
+#define BATTERY_COMP_SHIFT 12
+#define BATTERY_COMP_ONE (1 << BATTERY_COMP_SHIFT)
+
+// Voltage the motor speeds were tuned at
+#define BATTERY_NOMINAL_MV 9900
 
 /*******************************************************************************
  * PUBLIC TYPEDEFS                                                             *
@@ -25,50 +37,53 @@
 /*******************************************************************************
  * PUBLIC FUNCTION PROTOTYPES                                                  *
  ******************************************************************************/
+
 /**
- * @Function uint8_t getBeaconVal()
- * @param Priority - internal variable to track which event queue to use
- * @return uint8_t
- * @brief This function returns private variable module for current status of the 
- * beacon.
+ * @Function getBatteryMillivolts()
+ * @return filtered battery voltage in mV
  */
-uint8_t getBeaconVal();
+uint16_t getBatteryMillivolts();
 
 /**
- * @Function InitBeaconDebounceService(uint8_t Priority)
+ * @Function getBatteryCompensation()
+ * @return BATTERY_NOMINAL_MV / battery voltage in Q12
+ * @brief Multiply a duty cycle by this and shift right by BATTERY_COMP_SHIFT to
+ *        get the same average motor voltage at any charge. Stays at
+ *        BATTERY_COMP_ONE while the battery is disconnected.
+ */
+uint16_t getBatteryCompensation();
+
+/**
+ * @Function InitBatteryMonitorService(uint8_t Priority)
  * @param Priority - internal variable to track which event queue to use
  * @return TRUE or FALSE
  * @brief This will get called by the framework at the beginning of the code
  *        execution. It will post an ES_INIT event to the appropriate event
- *        queue, which will be handled inside RunTemplateService function. Remember
- *        to rename this to something appropriate.
+ *        queue, which will be handled inside RunBatteryMonitorService function.
  *        Returns TRUE if successful, FALSE otherwise
  */
-uint8_t InitBeaconDebounceService(uint8_t Priority);
+uint8_t InitBatteryMonitorService(uint8_t Priority);
 
 /**
- * @Function PostBeaconDebounceService(ES_Event ThisEvent)
+ * @Function PostBatteryMonitorService(ES_Event ThisEvent)
  * @param ThisEvent - the event (type and param) to be posted to queue
  * @return TRUE or FALSE
  * @brief This function is a wrapper to the queue posting function, and its name
  *        will be used inside ES_Configure to point to which queue events should
- *        be posted to. Remember to rename to something appropriate.
+ *        be posted to.
  *        Returns TRUE if successful, FALSE otherwise
  */
-uint8_t PostBeaconDebounceService(ES_Event ThisEvent);
+uint8_t PostBatteryMonitorService(ES_Event ThisEvent);
 
 /**
- * @Function RunBeaconDebounceService(ES_Event ThisEvent)
+ * @Function RunBatteryMonitorService(ES_Event ThisEvent)
  * @param ThisEvent - the event (type and param) to be responded.
  * @return Event - return event (type and param), in general should be ES_NO_EVENT
- * @brief This function is where you implement the whole of the service,
- *        as this is called any time a new event is passed to the event queue. 
- * @note Remember to rename to something appropriate.
- *       Returns ES_NO_EVENT if the event have been "consumed." 
+ * @brief Samples the battery once per BATTERY_TIMER timeout, updates the filter
+ *        and the compensation factor and posts connect/disconnect events.
+ *       Returns ES_NO_EVENT if the event have been "consumed."
  */
-ES_Event RunBeaconDebounceService(ES_Event ThisEvent);
-
-
+ES_Event RunBatteryMonitorService(ES_Event ThisEvent);
 
-#endif /* BEACON_DEBOUNCE_H */
 
+#endif /* BATTERY_MONITOR_H */
@@ -0,0 +1,130 @@
+/*
+ * File:   InputSampling.h
+ * Author: TeamPutterWorth
+ *
+ * This service samples the bumpers on PORTW once per tick and debounces them
+ * with the vertical counter debouncer. The track wires are read from the Timer5
+ * interrupt by trackWireCapture and the beacon edges are timestamped by the
+ * change notification ISR, the getters below pass their values on.
+ *
+ */
+
+#ifndef INPUT_SAMPLING_H
+#define INPUT_SAMPLING_H
+
+
+/*******************************************************************************
+ * PUBLIC #INCLUDES                                                            *
+ ******************************************************************************/
+
+#include "ES_Configure.h"   // defines ES_Event, INIT_EVENT, ENTRY_EVENT, and EXIT_EVENT
+#include "sensors.h"
+#include "debounce.h"
+
+/*******************************************************************************
+ * PUBLIC #DEFINES                                                             *
+ ******************************************************************************/
+
+#define NUM_BUMPERS 3
+
+/*******************************************************************************
+ * PUBLIC TYPEDEFS                                                             *
+ ******************************************************************************/
+
+
+/*******************************************************************************
+ * PUBLIC FUNCTION PROTOTYPES                                                  *
+ ******************************************************************************/
+
+/**
+ * @Function uint8_t getBeaconVal()
+ * @return uint8_t
+ * @brief This function returns the debounced status of the beacon, 1 if it is
+ * seen. Updated when BEACON_TRIGGERED goes through this service.
+ */
+uint8_t getBeaconVal();
+
+/**
+ * @Function getBeaconBearing(uint16_t *heading)
+ * @param heading - set to the world heading of the middle of the beacon lobe
+ * @return TRUE once for every lobe the robot has turned all the way through
+ * @brief The pose heading is taken on the rising and the falling edge and
+ * moved from the time of its pose step to the time the ISR stamped on the edge,
+ * at the rate the robot turned across the lobe. The middle of the two is where
+ * the beacon is.
+ */
+uint8_t getBeaconBearing(uint16_t *heading);
+
+/**
+ * @Function beaconBearingReset()
+ * @brief Forgets any lobe and any rising edge seen so far, call it as a scan
+ * starts so a lobe is only made of edges from that scan. A lobe the robot is
+ * already inside is dropped, its rise was before the scan.
+ */
+void beaconBearingReset();
+
+ /*
+ *@Function getTrackWireVals()
+ * @return curVal
+ * @brief This function returns the current value stored on both track wires,
+ * index 0 is the front. Values are active low like the raw output (0 = ON).
+ */
+uint8_t * getTrackWireVals();
+
+/**
+ * @Function getTrackWireStrength(uint8_t wire), getBeaconStrength()
+ * @param wire - 0 for the front track wire, 1 for the back
+ * @return how often the detector fired over its last ON_FRACTION_WINDOW raw
+ * samples, 0 (never) to ON_FRACTION_MAX (every sample)
+ * @brief The detectors only give a bit, but near the edge of their range the
+ * comparator fires on some samples and not others. This tells barely in range
+ * from dead ahead, the debounced values above can't. A track wire is read
+ * every 2 * TW_SETTLE_US (1 ms), a 32 ms window, the beacon every sample tick
+ * (2 ms), a 64 ms window.
+ */
+uint8_t getTrackWireStrength(uint8_t wire);
+uint8_t getBeaconStrength();
+
+/**
+ * @Function getInputSnapshot()
+ * @return pointer to the snapshot
+ * @brief Returns the raw input snapshot taken on the most recent tick. Use the
+ * snapshot helpers in sensors.h to decode it instead of reading the ports again.
+ */
+const InputSnapshot_t * getInputSnapshot();
+
+/**
+ * @Function InitInputSamplingService(uint8_t Priority)
+ * @param Priority - internal variable to track which event queue to use
+ * @return TRUE or FALSE
+ * @brief This will get called by the framework at the beginning of the code
+ *        execution. It will post an ES_INIT event to the appropriate event
+ *        queue, which will be handled inside RunInputSamplingService function.
+ *        Returns TRUE if successful, FALSE otherwise
+ */
+uint8_t InitInputSamplingService(uint8_t Priority);
+
+/**
+ * @Function PostInputSamplingService(ES_Event ThisEvent)
+ * @param ThisEvent - the event (type and param) to be posted to queue
+ * @return TRUE or FALSE
+ * @brief This function is a wrapper to the queue posting function, and its name
+ *        will be used inside ES_Configure to point to which queue events should
+ *        be posted to.
+ *        Returns TRUE if successful, FALSE otherwise
+ */
+uint8_t PostInputSamplingService(ES_Event ThisEvent);
+
+/**
+ * @Function RunInputSamplingService(ES_Event ThisEvent)
+ * @param ThisEvent - the event (type and param) to be responded.
+ * @return Event - return event (type and param), in general should be ES_NO_EVENT
+ * @brief Runs one sample and debounce pass per INPUT_SAMPLE_TIMER timeout and
+ *        posts BUMPED to the TopLevelHSM. BEACON_TRIGGERED from the event
+ *        checker is passed on to the TopLevelHSM once its edge is recorded.
+ *       Returns ES_NO_EVENT if the event have been "consumed."
+ */
+ES_Event RunInputSamplingService(ES_Event ThisEvent);
+
+
+#endif /* INPUT_SAMPLING_H */
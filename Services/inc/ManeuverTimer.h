@@ -0,0 +1,31 @@
+/*
+ * File:   ManeuverTimer.h
+ * Author: jdgrant
+ *
+ * Timers for moves that cover a distance by driving for a fixed time. The
+ * encoders give the speed the robot actually gets for the duty it is asked to
+ * run at, and each duration is stretched by how far that has dropped since the
+ * first moves of the match, so a timed move goes the same distance on a tired
+ * battery as on a fresh one.
+ *
+ */
+
+#ifndef MANEUVER_TIMER_H
+#define MANEUVER_TIMER_H
+
+#include <stdint.h>
+
+// getManeuverScale() is Q12, MANEUVER_SCALE_ONE means the speed hasn't changed
+#define MANEUVER_SCALE_SHIFT 12
+#define MANEUVER_SCALE_ONE (1 << MANEUVER_SCALE_SHIFT)
+
+// ES_Timer_InitTimer() with NewTime scaled for the current speed.
+void maneuverTimerStart(uint8_t Num, uint32_t NewTime);
+
+// returns the factor timed moves are stretched by, Q12
+uint16_t getManeuverScale();
+
+// One model update, run by MotionControl on every POSE_UPDATED.
+void maneuverTimerUpdate();
+
+#endif /* MANEUVER_TIMER_H */
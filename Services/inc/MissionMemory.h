@@ -0,0 +1,55 @@
+/*
+ * File:   MissionMemory.h
+ * Author: jdgrant
+ *
+ * Remembers where the loading tower and both targets were found, as poses from
+ * the PoseEstimator, so later ammo cycles can drive straight back instead of
+ * searching from scratch. The direct approach runs off the pose tick and posts
+ * APPROACH_DONE to the TopLevelHSM when it gets there or gives up, the search
+ * sub HSMs carry on with their normal search from there.
+ *
+ */
+
+#ifndef MISSION_MEMORY_H
+#define MISSION_MEMORY_H
+
+#include <stdint.h>
+
+// Places we remember
+#define MISSION_TOWER 0
+#define MISSION_FIRST_TARGET 1
+#define MISSION_SECOND_TARGET 2
+#define MISSION_PLACES 3
+
+// APPROACH_DONE params
+#define APPROACH_FAILED 0
+#define APPROACH_ARRIVED 1
+
+// Stores the current pose as the place, if the pose is good enough to use again.
+void missionRecord(uint8_t place);
+
+// Drops a place, for when the direct approach found nothing there.
+void missionForget(uint8_t place);
+
+// returns TRUE if the place is known and the robot knows where it is well enough
+// to drive back to it
+uint8_t missionRemembered(uint8_t place);
+
+// Corrects the pose heading from the middle of a beacon lobe (a world heading
+// from getBeaconBearing()) seen while searching for a remembered place, and
+// moves lobeHeading along with it so it still points at the beacon. Ignored if
+// the place is too close, or the lobe is too far off it to be its beacon.
+void missionBeaconSighted(uint8_t place, uint16_t *lobeHeading);
+
+// Starts driving toward a remembered place through setTwist(). If the place
+// can't be used any more APPROACH_DONE(APPROACH_FAILED) is posted right away.
+void missionApproachStart(uint8_t place);
+
+// Stops the approach, the motors are left at their last command.
+void missionApproachStop();
+
+// One steering step, run by MotionControl on every POSE_UPDATED. Does nothing
+// unless an approach is running.
+void missionApproachUpdate();
+
+#endif /* MISSION_MEMORY_H */
@@ -1,9 +1,16 @@
-// Joseph Grant
-// Midterm Problem 8
-// 11/1/16
+/*
+ * File:   MotionControl.h
+ * Author: TeamPutterWorth
+ *
+ * This service runs the motion helpers that steer off the pose: turns by angle,
+ * direct approaches to remembered places, tower homing and the maneuver timer
+ * model. The PoseEstimator posts POSE_UPDATED on its distribution list after
+ * every dead reckoning step and each helper takes one step on it.
+ *
+ */
 
-#ifndef Bumper_Debounce_H  // <- This should be changed to your own guard on both
-#define Bumper_Debounce_H  //    of these lines
+#ifndef MOTION_CONTROL_H
+#define MOTION_CONTROL_H
 
 
 /*******************************************************************************
@@ -16,7 +23,6 @@
  * PUBLIC #DEFINES                                                             *
  ******************************************************************************/
 
-#define NUM_BUMPERS 3
 
 /*******************************************************************************
  * PUBLIC TYPEDEFS                                                             *
@@ -27,42 +33,37 @@
  * PUBLIC FUNCTION PROTOTYPES                                                  *
  ******************************************************************************/
 
- 
 /**
- * @Function InitSyncSamplingService(uint8_t Priority)
+ * @Function InitMotionControlService(uint8_t Priority)
  * @param Priority - internal variable to track which event queue to use
  * @return TRUE or FALSE
  * @brief This will get called by the framework at the beginning of the code
  *        execution. It will post an ES_INIT event to the appropriate event
- *        queue, which will be handled inside RunTemplateService function. Remember
- *        to rename this to something appropriate.
+ *        queue, which will be handled inside RunMotionControlService function.
  *        Returns TRUE if successful, FALSE otherwise
  */
-uint8_t InitBumperDebounceService(uint8_t Priority);
+uint8_t InitMotionControlService(uint8_t Priority);
 
 /**
- * @Function PostSyncSamplingService(ES_Event ThisEvent)
+ * @Function PostMotionControlService(ES_Event ThisEvent)
  * @param ThisEvent - the event (type and param) to be posted to queue
  * @return TRUE or FALSE
  * @brief This function is a wrapper to the queue posting function, and its name
  *        will be used inside ES_Configure to point to which queue events should
- *        be posted to. Remember to rename to something appropriate.
+ *        be posted to.
  *        Returns TRUE if successful, FALSE otherwise
  */
-uint8_t PostBumperDebounceService(ES_Event ThisEvent);
+uint8_t PostMotionControlService(ES_Event ThisEvent);
 
 /**
- * @Function RunSyncSamplingService(ES_Event ThisEvent)
+ * @Function RunMotionControlService(ES_Event ThisEvent)
  * @param ThisEvent - the event (type and param) to be responded.
  * @return Event - return event (type and param), in general should be ES_NO_EVENT
- * @brief This function is where you implement the whole of the service,
- *        as this is called any time a new event is passed to the event queue. 
- * @note Remember to rename to something appropriate.
- *       Returns ES_NO_EVENT if the event have been "consumed." 
+ * @brief Steps every motion helper once per POSE_UPDATED. Each one does nothing
+ *        unless it is running.
+ *       Returns ES_NO_EVENT if the event have been "consumed."
  */
-ES_Event RunBumperDebounceService(ES_Event ThisEvent);
-
-
+ES_Event RunMotionControlService(ES_Event ThisEvent);
 
-#endif /* Bumper_Debounce_H */
 
+#endif /* MOTION_CONTROL_H */
@@ -0,0 +1,151 @@
+/*
+ * File:   PoseEstimator.h
+ * Author: TeamPutterWorth
+ *
+ * This service dead reckons the robot's position and heading from the wheel
+ * encoders at a fixed rate, and keeps a rough variance for each so the HSMs can
+ * tell how far to trust it. Landmarks (tape, the loading tower, the beacon)
+ * correct it through the poseCorrect functions.
+ *
+ * The world frame has the loading tower contact point at the origin and
+ * headings are binary angles (65536 = one turn, counter clockwise positive).
+ * Until the first landmark the variances are at their limit.
+ *
+ */
+
+#ifndef POSE_ESTIMATOR_H
+#define POSE_ESTIMATOR_H
+
+
+/*******************************************************************************
+ * PUBLIC #INCLUDES                                                            *
+ ******************************************************************************/
+
+#include "ES_Configure.h"   // defines ES_Event, INIT_EVENT, ENTRY_EVENT, and EXIT_EVENT
+
+/*******************************************************************************
+ * PUBLIC #DEFINES                                                             *
+ ******************************************************************************/
+
+// Binary angles, a uint16_t wraps at one full turn
+#define POSE_BRAD_90 16384
+#define POSE_BRAD_180 32768
+#define POSE_BRAD_PER_RAD 10430 // 65536 / 2pi
+
+// Where the loading tower puts us when the track wire is touched
+#define POSE_TOWER_X 0
+#define POSE_TOWER_Y 0
+
+/*******************************************************************************
+ * PUBLIC TYPEDEFS                                                             *
+ ******************************************************************************/
+
+typedef struct {
+    int32_t x; // mm
+    int32_t y; // mm
+    uint16_t heading; // binary angle
+    uint32_t varX; // mm^2
+    uint32_t varY; // mm^2
+    uint32_t varHeading; // brad^2
+    uint32_t time; // ES time (ms) of the dead reckoning step the pose is from
+} Pose_t;
+
+/*******************************************************************************
+ * PUBLIC FUNCTION PROTOTYPES                                                  *
+ ******************************************************************************/
+
+/**
+ * @Function poseGet(Pose_t *pose)
+ * @param pose - filled with the current estimate and its variances
+ */
+void poseGet(Pose_t *pose);
+
+/**
+ * @Function poseReset(int32_t x, int32_t y, uint16_t heading)
+ * @brief Puts the robot at a known pose (mm, mm, brad) with zero variance.
+ */
+void poseReset(int32_t x, int32_t y, uint16_t heading);
+
+/**
+ * @Function poseCorrectX(int32_t x, uint32_t var)
+ * @param x - measured x in mm
+ * @param var - variance of the measurement in mm^2
+ * @brief Blends a landmark measurement into the estimate, weighted by the two
+ *        variances. poseCorrectY and poseCorrectHeading are the same for the
+ *        other components (heading variance is in brad^2).
+ */
+void poseCorrectX(int32_t x, uint32_t var);
+void poseCorrectY(int32_t y, uint32_t var);
+void poseCorrectHeading(uint16_t heading, uint32_t var);
+
+/**
+ * @Function poseCorrectSquare(uint16_t heading, uint32_t var)
+ * @param heading - a pose heading the robot has measured to be square to the
+ *        arena (tape lines and the tower faces run with the walls), in the pose
+ *        frame as it is now
+ * @param var - variance of the measurement in brad^2
+ * @brief Snaps to the nearest multiple of 90 degrees and corrects the heading by
+ *        the difference. Dropped while the heading is too uncertain to tell which
+ *        multiple is meant, or if the difference is too big for the line to be
+ *        one of the square ones. Until the heading has been fixed once, the
+ *        nearest multiple is taken as is and sets the frame.
+ */
+void poseCorrectSquare(uint16_t heading, uint32_t var);
+
+/**
+ * @Function poseSin(uint16_t angle), poseCos(uint16_t angle)
+ * @return sine/cosine of a binary angle in Q14 (16384 = 1.0)
+ */
+int16_t poseSin(uint16_t angle);
+int16_t poseCos(uint16_t angle);
+
+/**
+ * @Function poseBearingTo(int32_t x, int32_t y, uint32_t *distance)
+ * @param x, y - a point in the world frame in mm
+ * @param distance - if not NULL, set to the distance to the point in mm
+ * @return world heading that points from the robot at (x, y)
+ */
+uint16_t poseBearingTo(int32_t x, int32_t y, uint32_t *distance);
+
+/**
+ * @Function poseAtan2(int32_t y, int32_t x, uint32_t *magnitude)
+ * @param y, x - a vector in mm (or any unit under about 8 m)
+ * @param magnitude - if not NULL, set to the length of the vector
+ * @return angle of the vector as a binary angle
+ */
+uint16_t poseAtan2(int32_t y, int32_t x, uint32_t *magnitude);
+
+/**
+ * @Function InitPoseEstimatorService(uint8_t Priority)
+ * @param Priority - internal variable to track which event queue to use
+ * @return TRUE or FALSE
+ * @brief This will get called by the framework at the beginning of the code
+ *        execution. It will post an ES_INIT event to the appropriate event
+ *        queue, which will be handled inside RunPoseEstimatorService function.
+ *        Returns TRUE if successful, FALSE otherwise
+ */
+uint8_t InitPoseEstimatorService(uint8_t Priority);
+
+/**
+ * @Function PostPoseEstimatorService(ES_Event ThisEvent)
+ * @param ThisEvent - the event (type and param) to be posted to queue
+ * @return TRUE or FALSE
+ * @brief This function is a wrapper to the queue posting function, and its name
+ *        will be used inside ES_Configure to point to which queue events should
+ *        be posted to.
+ *        Returns TRUE if successful, FALSE otherwise
+ */
+uint8_t PostPoseEstimatorService(ES_Event ThisEvent);
+
+/**
+ * @Function RunPoseEstimatorService(ES_Event ThisEvent)
+ * @param ThisEvent - the event (type and param) to be responded.
+ * @return Event - return event (type and param), in general should be ES_NO_EVENT
+ * @brief Integrates the encoder travel once per POSE_TIMER timeout and posts
+ *        POSE_UPDATED to distribution list 0 (the MotionControl service).
+ *       Returns ES_NO_EVENT if the event have been "consumed."
+ */
+ES_Event RunPoseEstimatorService(ES_Event ThisEvent);
+
+
+#endif /* POSE_ESTIMATOR_H */
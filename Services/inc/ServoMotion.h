@@ -0,0 +1,106 @@
+/*
+ * File:   ServoMotion.h
+ * Author: TeamPutterWorth
+ *
+ * This service moves the unloading and bridge servos along timed profiles in
+ * the background. A move slews the pulse linearly to its target over a given
+ * time, holds there and then posts a single SERVO_DONE to the TopLevelHSM with
+ * the servo as the param, so the HSMs don't have to step the pulse themselves.
+ *
+ */
+
+#ifndef SERVO_MOTION_H
+#define SERVO_MOTION_H
+
+
+/*******************************************************************************
+ * PUBLIC #INCLUDES                                                            *
+ ******************************************************************************/
+
+#include "ES_Configure.h"   // defines ES_Event, INIT_EVENT, ENTRY_EVENT, and EXIT_EVENT
+
+/*******************************************************************************
+ * PUBLIC #DEFINES                                                             *
+ ******************************************************************************/
+
+// Servos, also the SERVO_DONE param
+#define SERVO_UNLOADING 0
+#define SERVO_BRIDGE 1
+#define NUM_SERVOS 2
+
+// Unloading servo profile, for the UNLOADING_*_PULSE positions in sensors.h.
+// Same 5 us per ms the old 10 us steps every SERVO_TIMER gave, then give the
+// balls time to roll out
+#define UNLOAD_HIGH_SLEW_MS ((UNLOADING_HIGH_PULSE - UNLOADING_CENTER_PULSE) / 5)
+#define UNLOAD_LOW_SLEW_MS ((UNLOADING_CENTER_PULSE - UNLOADING_LOW_PULSE) / 5)
+#define UNLOAD_HOLD_MS (5 * LONG_TIMER_TICKS / 2)
+
+/*******************************************************************************
+ * PUBLIC TYPEDEFS                                                             *
+ ******************************************************************************/
+
+
+/*******************************************************************************
+ * PUBLIC FUNCTION PROTOTYPES                                                  *
+ ******************************************************************************/
+
+/**
+ * @Function servoMotionStart(uint8_t servo, uint16_t pulse, uint16_t slewMs,
+ *           uint16_t holdMs)
+ * @param servo - SERVO_UNLOADING or SERVO_BRIDGE
+ * @param pulse - target pulse in us
+ * @param slewMs - time to get from the current pulse to the target
+ * @param holdMs - time to sit at the target before SERVO_DONE
+ * @brief Replaces any move already running on that servo, the new one starts
+ *        from wherever the old one had got to.
+ */
+void servoMotionStart(uint8_t servo, uint16_t pulse, uint16_t slewMs, uint16_t holdMs);
+
+/**
+ * @Function servoMotionSet(uint8_t servo, uint16_t pulse)
+ * @brief Cancels any move on the servo and jumps straight to pulse, no
+ *        SERVO_DONE is posted.
+ */
+void servoMotionSet(uint8_t servo, uint16_t pulse);
+
+/**
+ * @Function servoMotionRunning(uint8_t servo)
+ * @return TRUE while a move on the servo hasn't posted its SERVO_DONE yet
+ */
+uint8_t servoMotionRunning(uint8_t servo);
+
+/**
+ * @Function InitServoMotionService(uint8_t Priority)
+ * @param Priority - internal variable to track which event queue to use
+ * @return TRUE or FALSE
+ * @brief This will get called by the framework at the beginning of the code
+ *        execution. It will post an ES_INIT event to the appropriate event
+ *        queue, which will be handled inside RunServoMotionService function.
+ *        Returns TRUE if successful, FALSE otherwise
+ */
+uint8_t InitServoMotionService(uint8_t Priority);
+
+/**
+ * @Function PostServoMotionService(ES_Event ThisEvent)
+ * @param ThisEvent - the event (type and param) to be posted to queue
+ * @return TRUE or FALSE
+ * @brief This function is a wrapper to the queue posting function, and its name
+ *        will be used inside ES_Configure to point to which queue events should
+ *        be posted to.
+ *        Returns TRUE if successful, FALSE otherwise
+ */
+uint8_t PostServoMotionService(ES_Event ThisEvent);
+
+/**
+ * @Function RunServoMotionService(ES_Event ThisEvent)
+ * @param ThisEvent - the event (type and param) to be responded.
+ * @return Event - return event (type and param), in general should be ES_NO_EVENT
+ * @brief Steps every running move once per SERVO_TIMER timeout and posts
+ *        SERVO_DONE for the ones that finished. The timer only runs while a
+ *        move does.
+ *       Returns ES_NO_EVENT if the event have been "consumed."
+ */
+ES_Event RunServoMotionService(ES_Event ThisEvent);
+
+
+#endif /* SERVO_MOTION_H */
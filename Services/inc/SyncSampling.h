@@ -18,6 +18,10 @@
 
 #define NOT_FOLLOWING 0xF
 
+// getLineOffset() is Q8 in units of the front sensor spacing: -256 is the line
+// centred under FL, 0 under FM and +256 under FR.
+#define LINE_OFFSET_ONE 256
+
 /*******************************************************************************
  * PUBLIC TYPEDEFS                                                             *
  ******************************************************************************/
@@ -66,5 +70,24 @@ uint8_t getLastTape();
 
 void setLastTape(uint8_t val);
 
+/*
+ * desc: lateral position of the tape under the front sensors as a centroid of
+ * the FL, FM and FR differentials. Updated on every tape frame. Positive means
+ * the line is to the right of centre. Only meaningful while getLineDetected().
+ */
+int16_t getLineOffset();
+
+// returns TRUE if at least one front sensor sees enough tape to trust the offset
+uint8_t getLineDetected();
+
+/*
+ * desc: angle of the last tape line both front corners (FL, FR) or both back
+ * corners (BL, BR) crossed while driving straight, from the time between the two
+ * crossings and the wheel speed. degrees is the tank turn (positive left) that
+ * squares the direction of travel up with the line. Returns FALSE if no line has
+ * been measured since the last call, or the last corner crossing didn't pair up.
+ */
+uint8_t getTapeApproachAngle(int16_t *degrees);
+
 #endif /* SYNC_SAMPLING_H */
 
@@ -0,0 +1,31 @@
+/*
+ * File:   TapeFollow.h
+ * Author: jdgrant
+ *
+ * Closed loop tape following. SyncSampling calls tapeFollowUpdate() on every
+ * tape frame, while running it steers the wheels differentially from the line
+ * offset with a fixed point PID. If the line is lost and recovery fails it posts
+ * TAPE_LOST to the TopLevelHSM and stops itself.
+ *
+ */
+
+#ifndef TAPE_FOLLOW_H
+#define TAPE_FOLLOW_H
+
+#include <stdint.h>
+
+// Starts the controller. side is which side of the robot the tape should sit on
+// (LEFT 0 / RIGHT 1), the robot tracks half a sensor spacing to that side of FM.
+void tapeFollowStart(uint8_t side);
+
+// Stops the controller, the motors are left at their last command.
+void tapeFollowStop();
+
+// returns TRUE while the controller is driving the motors
+uint8_t tapeFollowRunning();
+
+// One control step, called by SyncSampling once per tape frame. Does nothing
+// unless the controller is running.
+void tapeFollowUpdate();
+
+#endif /* TAPE_FOLLOW_H */
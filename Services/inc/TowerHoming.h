@@ -0,0 +1,30 @@
+/*
+ * File:   TowerHoming.h
+ * Author: jdgrant
+ *
+ * Backs the robot into the loading tower by following the track wire field. The
+ * back detector's strength is checked as the robot weaves in, when it drops the
+ * weave swaps sides so the robot keeps climbing the gradient, it also swaps on a
+ * timer, and while the front detector hears the tower better than the back the
+ * robot spins to bring its back round. Once the back detector saturates the
+ * robot backs straight in. Steps on POSE_UPDATED, the AmmoLoad HSM ends it on
+ * the back bumper.
+ *
+ */
+
+#ifndef TOWER_HOMING_H
+#define TOWER_HOMING_H
+
+#include <stdint.h>
+
+// Starts backing in, turning the back toward the tower first if it needs to.
+void towerHomingStart();
+
+// Stops homing and the motors.
+void towerHomingStop();
+
+// One steering step, run by MotionControl on every POSE_UPDATED. Does nothing
+// unless homing is running.
+void towerHomingUpdate();
+
+#endif /* TOWER_HOMING_H */
@@ -0,0 +1,58 @@
+/*
+ * File:   TurnControl.h
+ * Author: jdgrant
+ *
+ * Tank turns by angle instead of by time. The turn is steered off the pose
+ * heading and slows down as it gets close so it doesn't overshoot, then posts
+ * TURN_DONE to the TopLevelHSM. If the encoders don't show the robot turning
+ * it falls back to timing the turn from the measured turn rate.
+ *
+ */
+
+#ifndef TURN_CONTROL_H
+#define TURN_CONTROL_H
+
+#include <stdint.h>
+
+// Timed turns follow the turn rate measured off the tape, which starts out at
+// TURN_TICKS_NOMINAL (ms per revolution).
+#define TURN_TICKS_NOMINAL 3150
+
+#define TIMER_360_TICKS getTurnTicksPerRev()
+#define TIMER_45_TICKS ((TIMER_360_TICKS*2)/9)
+#define TIMER_22_TICKS TIMER_45_TICKS/2
+#define TIMER_90_TICKS ((TIMER_360_TICKS/4)-(TIMER_360_TICKS/42))
+#define TIMER_180_TICKS TIMER_360_TICKS/2
+
+// Starts a tank turn of degrees, positive turns left (counter clockwise).
+void turnByAngle(int16_t degrees);
+
+// Turns the shortest way to a world heading (binary angle, like the pose).
+void turnToHeading(uint16_t heading);
+
+// Stops the turn controller, the motors are left at their last command.
+void turnStop();
+
+// returns TRUE while a turn is in progress
+uint8_t turnRunning();
+
+// One control step, run by MotionControl on every POSE_UPDATED. Does nothing
+// unless a turn is running.
+void turnUpdate();
+
+/*
+ * Turn rate measurement. During a constant speed tank turn the front middle
+ * tape sensor crosses a straight tape line twice per revolution, so every other
+ * crossing is one full turn apart. Between start and stop any constant speed
+ * spin feeds the estimate.
+ */
+void turnRateMeasureStart();
+void turnRateMeasureStop();
+
+// Called by SyncSampling when the front middle sensor goes onto tape.
+void turnRateCrossing();
+
+// returns the filtered ES timer ticks (ms) per revolution at the turn speed
+uint16_t getTurnTicksPerRev(void);
+
+#endif /* TURN_CONTROL_H */
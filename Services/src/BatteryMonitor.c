@@ -0,0 +1,221 @@
+/*
+ * File:   BatteryMonitor.c
+ * Author: TeamPutterWorth
+ *
+ * This service keeps a filtered reading of the battery voltage in millivolts and
+ * a cached fixed point compensation factor the motor driver scales its duty
+ * cycles by. It posts BATTERY_CONNECTED/BATTERY_DISCONNECTED on the power switch.
+ *
+ */
+
+/*******************************************************************************
+ * MODULE #INCLUDE                                                             *
+ ******************************************************************************/
+
+#include "BOARD.h"
+#include "AD.h"
+#include "ES_Configure.h"
+#include "ES_Framework.h"
+#include "BatteryMonitor.h"
+#include "motorDuty.h"
+#include <stdio.h>
+
+/*******************************************************************************
+ * MODULE #DEFINES                                                             *
+ ******************************************************************************/
+//#define DEBUG
+#define BATTERY_SAMPLE_TICKS 10 // 10 ticks = 10 ms
+
+// The battery input is divided down by 10, so full scale (1023) is 33 V
+#define AD_FULL_SCALE_MV 33000
+#define AD_FULL_SCALE 1023
+
+// IIR filter, filtered += (new - filtered) / 2^FILTER_SHIFT. The state keeps
+// FILTER_SHIFT extra fraction bits so small steps aren't lost. 80 ms time constant.
+#define FILTER_SHIFT 3
+
+// With the switch off the pin only sees what leaks from USB, hysteresis so a
+// sagging battery under load doesn't read as a disconnect.
+#define CONNECTED_MV 5000
+#define DISCONNECTED_MV 4000
+
+// Don't let a nearly flat battery ask for more than twice the duty cycle
+#define MAX_COMPENSATION (2 * BATTERY_COMP_ONE)
+
+/*******************************************************************************
+ * PRIVATE FUNCTION PROTOTYPES                                                 *
+ ******************************************************************************/
+
+static uint16_t readBatteryMillivolts();
+static void updateCompensation();
+
+/*******************************************************************************
+ * PRIVATE MODULE VARIABLES                                                    *
+ ******************************************************************************/
+
+static uint8_t MyPriority;
+static uint32_t filteredMv = 0; // Q(FILTER_SHIFT)
+static uint16_t batteryMv = 0;
+static uint16_t compensation = BATTERY_COMP_ONE;
+static uint8_t connected = FALSE;
+
+/*******************************************************************************
+ * PUBLIC FUNCTIONS                                                            *
+ ******************************************************************************/
+
+uint16_t getBatteryMillivolts()
+{
+    return batteryMv;
+}
+
+uint16_t getBatteryCompensation()
+{
+    return compensation;
+}
+
+/**
+ * @Function InitBatteryMonitorService(uint8_t Priority)
+ * @param Priority - internal variable to track which event queue to use
+ * @return TRUE or FALSE
+ * @brief This will get called by the framework at the beginning of the code
+ *        execution. It will post an ES_INIT event to the appropriate event
+ *        queue, which will be handled inside RunBatteryMonitorService function.
+ *
+ *        Returns TRUE if successful, FALSE otherwise
+ */
+uint8_t InitBatteryMonitorService(uint8_t Priority) {
+    ES_Event ThisEvent;
+
+    MyPriority = Priority;
+
+    // Start the filter at the current reading so it doesn't have to ramp up
+    batteryMv = readBatteryMillivolts();
+    filteredMv = (uint32_t)batteryMv << FILTER_SHIFT;
+    connected = (batteryMv >= CONNECTED_MV);
+    updateCompensation();
+
+    ES_Timer_InitTimer(BATTERY_TIMER, BATTERY_SAMPLE_TICKS);
+    // post the initial transition event
+    ThisEvent.EventType = ES_INIT;
+    if (ES_PostToService(MyPriority, ThisEvent) == TRUE) {
+        return TRUE;
+    } else {
+        return FALSE;
+    }
+}
+
+/**
+ * @Function PostBatteryMonitorService(ES_Event ThisEvent)
+ * @param ThisEvent - the event (type and param) to be posted to queue
+ * @return TRUE or FALSE
+ * @brief This function is a wrapper to the queue posting function, and its name
+ *        will be used inside ES_Configure to point to which queue events should
+ *        be posted to.
+ *
+ *        Returns TRUE if successful, FALSE otherwise
+ */
+uint8_t PostBatteryMonitorService(ES_Event ThisEvent) {
+    return ES_PostToService(MyPriority, ThisEvent);
+}
+
+/**
+ * @Function RunBatteryMonitorService(ES_Event ThisEvent)
+ * @param ThisEvent - the event (type and param) to be responded.
+ * @return Event - return event (type and param), in general should be ES_NO_EVENT
+ * @brief Samples the battery once per BATTERY_TIMER timeout, updates the filter
+ *        and the compensation factor and posts connect/disconnect events to the
+ *        TopLevelHSM with the filtered mV as the param.
+ *
+ *       Returns ES_NO_EVENT if the event have been "consumed."
+ */
+ES_Event RunBatteryMonitorService(ES_Event ThisEvent)
+{
+    ES_Event ReturnEvent;
+    ES_Event PostEvent;
+    int32_t delta;
+    ReturnEvent.EventType = ES_NO_EVENT; // assume no errors
+
+    switch (ThisEvent.EventType)
+    {
+        case ES_INIT:
+            break;
+
+        case ES_TIMERACTIVE:
+
+        case ES_TIMERSTOPPED:
+            break;
+
+        case ES_TIMEOUT:
+            if (ThisEvent.EventParam != BATTERY_TIMER)
+            {
+                break;
+            }
+            ES_Timer_InitTimer(BATTERY_TIMER, BATTERY_SAMPLE_TICKS);
+
+            delta = ((int32_t)readBatteryMillivolts() << FILTER_SHIFT) - (int32_t)filteredMv;
+            filteredMv += delta / (1 << FILTER_SHIFT);
+            batteryMv = filteredMv >> FILTER_SHIFT;
+
+            PostEvent.EventType = ES_NO_EVENT;
+            if (!connected && batteryMv >= CONNECTED_MV)
+            {
+                connected = TRUE;
+                PostEvent.EventType = BATTERY_CONNECTED;
+            }
+            else if (connected && batteryMv < DISCONNECTED_MV)
+            {
+                connected = FALSE;
+                PostEvent.EventType = BATTERY_DISCONNECTED;
+            }
+            updateCompensation();
+
+            if (PostEvent.EventType != ES_NO_EVENT)
+            {
+                PostEvent.EventParam = batteryMv;
+                #ifdef DEBUG
+                printf("\r\n%s at %u mV", EventNames[PostEvent.EventType], batteryMv);
+                #endif
+                PostTopLevelHSM(PostEvent);
+            }
+            break;
+
+        default:
+            printf("\r\nRecieved Event: %s with Param: 0x%X",
+                    EventNames[ThisEvent.EventType], ThisEvent.EventParam);
+            break;
+    }
+    return ReturnEvent;
+}
+
+/*******************************************************************************
+ * PRIVATE FUNCTIONS                                                           *
+ ******************************************************************************/
+
+static uint16_t readBatteryMillivolts()
+{
+    return ((uint32_t)AD_ReadADPin(BAT_VOLTAGE) * AD_FULL_SCALE_MV) / AD_FULL_SCALE;
+}
+
+/*
+ * The division happens here once per sample. The motor driver precomputes its
+ * duty table from the result, so motor commands are just a lookup.
+ */
+static void updateCompensation()
+{
+    uint32_t comp;
+
+    if (!connected)
+    {
+        comp = BATTERY_COMP_ONE;
+    }
+    else
+    {
+        comp = ((uint32_t)BATTERY_NOMINAL_MV << BATTERY_COMP_SHIFT) / batteryMv;
+        if (comp > MAX_COMPENSATION)
+        {
+            comp = MAX_COMPENSATION;
+        }
+    }
+    compensation = comp;
+    motorDutySetCompensation(compensation);
+}
@@ -0,0 +1,333 @@
+/*
+ * File:   InputSampling.c
+ * Author: TeamPutterWorth
+ *
+ * This service samples the bumpers on PORTW once per tick and debounces them
+ * with the vertical counter debouncer. It replaces the separate bumper and
+ * beacon debounce services. The track wires share the mux with the tape LEDs and
+ * are sampled from the Timer5 interrupt by trackWireCapture instead. Beacon
+ * edges are timestamped by the change notification ISR and come in here as
+ * BEACON_TRIGGERED from checkBeaconEdge, the raw beacon is only sampled for its
+ * strength.
+ *
+ */
+
+/*******************************************************************************
+ * MODULE #INCLUDE                                                             *
+ ******************************************************************************/
+
+#include "BOARD.h"
+#include "IO_Ports.h"
+#include "ES_Configure.h"
+#include "ES_Framework.h"
+#include "InputSampling.h"
+#include "sensors.h"
+#include "debounce.h"
+#include "trackWireCapture.h"
+#include "PoseEstimator.h"
+#include <stdio.h>
+
+/*******************************************************************************
+ * MODULE #DEFINES                                                             *
+ ******************************************************************************/
+//#define DEBUG
+#define INPUT_SAMPLE_TICKS 2 // 2 ticks = 2 ms
+
+#define ON 0
+#define OFF 1
+
+// Debounced input word, every bit is 1 when the input is active
+#define IN_FR_BUMPER 0x01
+#define IN_FL_BUMPER 0x02
+#define IN_B_BUMPER 0x04
+#define IN_BUMPERS (IN_FR_BUMPER|IN_FL_BUMPER|IN_B_BUMPER)
+#define IN_BUMPER_SH 3 // bumpers sit at PIN3-PIN5 on the port, bit 0-2 here
+
+// Thresholds are in samples of INPUT_SAMPLE_TICKS. The bumper press count only
+// matters as a fallback for the change notification path, the release count is
+// what rejects chatter. A latched pin is re-armed once the raw level has been
+// low for BUMPER_RELEASE samples since the latch, whether or not the debouncer
+// ever saw the press, so a glitch shorter than BUMPER_PRESS can't hold it.
+#define BUMPER_PRESS 15
+#define BUMPER_RELEASE 3
+
+/*******************************************************************************
+ * PRIVATE FUNCTION PROTOTYPES                                                 *
+ ******************************************************************************/
+
+static void beaconEdge(uint8_t seen, uint32_t edgeTime);
+static void bumperRearm(uint16_t sample);
+
+/*******************************************************************************
+ * PRIVATE MODULE VARIABLES                                                    *
+ ******************************************************************************/
+
+static uint8_t MyPriority;
+static Debouncer_t inputs;
+static uint16_t bumperLatchSeen = 0; // latched pins as of the last sample
+static uint8_t bumperLowRun[NUM_BUMPERS] = {0, 0, 0}; // raw low samples since the latch
+static uint8_t savedBeaconVal = 0;
+static uint8_t curVal[] = {OFF,OFF};
+static InputSnapshot_t snapshot;
+static OnFraction_t beaconStrength;
+static uint8_t beaconRisen = FALSE;
+static uint16_t beaconRiseHeading = 0;
+static uint32_t beaconRisePoseTime = 0; // ES time (ms) of the rise heading
+static uint32_t beaconRiseEdgeTime = 0;
+static uint8_t beaconLobeValid = FALSE;
+static uint16_t beaconLobeHeading = 0;
+
+/*******************************************************************************
+ * PUBLIC FUNCTIONS                                                            *
+ ******************************************************************************/
+
+uint8_t getBeaconVal()
+{
+    return savedBeaconVal;
+}
+
+uint8_t getBeaconBearing(uint16_t *heading)
+{
+    if (!beaconLobeValid)
+    {
+        return FALSE;
+    }
+    beaconLobeValid = FALSE;
+    *heading = beaconLobeHeading;
+    return TRUE;
+}
+
+void beaconBearingReset()
+{
+    beaconRisen = FALSE;
+    beaconLobeValid = FALSE;
+}
+
+uint8_t * getTrackWireVals()
+{
+    uint8_t state = trackWireCaptureState();
+
+    curVal[0] = (state & TW_F) ? ON : OFF;
+    curVal[1] = (state & TW_B) ? ON : OFF;
+    return curVal;
+}
+
+uint8_t getTrackWireStrength(uint8_t wire)
+{
+    return trackWireCaptureStrength(wire);
+}
+
+uint8_t getBeaconStrength()
+{
+    return onFractionGet(&beaconStrength);
+}
+
+const InputSnapshot_t * getInputSnapshot()
+{
+    return &snapshot;
+}
+
+/**
+ * @Function InitInputSamplingService(uint8_t Priority)
+ * @param Priority - internal variable to track which event queue to use
+ * @return TRUE or FALSE
+ * @brief This will get called by the framework at the beginning of the code
+ *        execution. It will post an ES_INIT event to the appropriate event
+ *        queue, which will be handled inside RunInputSamplingService function.
+ *
+ *        Returns TRUE if successful, FALSE otherwise
+ */
+uint8_t InitInputSamplingService(uint8_t Priority) {
+    ES_Event ThisEvent;
+
+    MyPriority = Priority;
+
+    debounceInit(&inputs, 0);
+    debounceSetThreshold(&inputs, IN_BUMPERS, BUMPER_PRESS, BUMPER_RELEASE);
+    onFractionInit(&beaconStrength);
+
+    ES_Timer_InitTimer(INPUT_SAMPLE_TIMER, INPUT_SAMPLE_TICKS);
+    // post the initial transition event
+    ThisEvent.EventType = ES_INIT;
+    if (ES_PostToService(MyPriority, ThisEvent) == TRUE) {
+        return TRUE;
+    } else {
+        return FALSE;
+    }
+}
+
+/**
+ * @Function PostInputSamplingService(ES_Event ThisEvent)
+ * @param ThisEvent - the event (type and param) to be posted to queue
+ * @return TRUE or FALSE
+ * @brief This function is a wrapper to the queue posting function, and its name
+ *        will be used inside ES_Configure to point to which queue events should
+ *        be posted to.
+ *
+ *        Returns TRUE if successful, FALSE otherwise
+ */
+uint8_t PostInputSamplingService(ES_Event ThisEvent) {
+    return ES_PostToService(MyPriority, ThisEvent);
+}
+
+/**
+ * @Function RunInputSamplingService(ES_Event ThisEvent)
+ * @param ThisEvent - the event (type and param) to be responded.
+ * @return Event - return event (type and param), in general should be ES_NO_EVENT
+ * @brief The input ports are read once per tick into a timestamped snapshot,
+ *        which is decoded into an active high input word.
+ *        The whole word goes through the debouncer in one pass, only the bits
+ *        that changed turn into events. BEACON_TRIGGERED from checkBeaconEdge
+ *        is turned into a lobe bearing and passed on to the TopLevelHSM.
+ *
+ *       Returns ES_NO_EVENT if the event have been "consumed."
+ */
+ES_Event RunInputSamplingService(ES_Event ThisEvent)
+{
+    ES_Event ReturnEvent;
+    ES_Event PostEvent;
+    uint16_t sample;
+    uint16_t changed;
+    uint16_t state;
+    ReturnEvent.EventType = ES_NO_EVENT; // assume no errors
+
+    switch (ThisEvent.EventType)
+    {
+        case ES_INIT:
+            break;
+
+        case BEACON_TRIGGERED:
+            savedBeaconVal = BEACON_EDGE_SEEN(ThisEvent.EventParam);
+            beaconEdge(savedBeaconVal, BEACON_EDGE_TIME(ThisEvent.EventParam, ES_Timer_GetTime()));
+            ThisEvent.EventParam = savedBeaconVal; // the HSMs only want the level
+            PostTopLevelHSM(ThisEvent);
+            break;
+
+        case ES_TIMERACTIVE:
+
+        case ES_TIMERSTOPPED:
+            break;
+
+        case ES_TIMEOUT:
+            if (ThisEvent.EventParam != INPUT_SAMPLE_TIMER)
+            {
+                break;
+            }
+            ES_Timer_InitTimer(INPUT_SAMPLE_TIMER, INPUT_SAMPLE_TICKS);
+
+            readInputSnapshot(&snapshot);
+            sample = snapshotBumpers(&snapshot);
+            onFractionUpdate(&beaconStrength, snapshotBeacon(&snapshot));
+            bumperRearm(sample);
+
+            changed = debounceUpdate(&inputs, sample, IN_BUMPERS);
+            if (!changed)
+            {
+                break;
+            }
+            state = debounceState(&inputs);
+            #ifdef DEBUG
+            printf("\r\nInputs: 0x%X changed: 0x%X", state, changed);
+            #endif
+
+            // Presses are normally reported by the change notification ISR the
+            // moment they happen, here we only catch any press it didn't see.
+            // bumperRearm() above takes care of releasing it.
+            if (changed & state & IN_BUMPERS)
+            {
+                PostEvent.EventParam = bumperEdgeClaim((changed & state & IN_BUMPERS) << IN_BUMPER_SH);
+                if (PostEvent.EventParam)
+                {
+                    PostEvent.EventType = BUMPED;
+                    PostTopLevelHSM(PostEvent);
+                }
+            }
+            break;
+
+        default:
+            printf("\r\nRecieved Event: %s with Param: 0x%X",
+                    EventNames[ThisEvent.EventType], ThisEvent.EventParam);
+            break;
+    }
+    return ReturnEvent;
+}
+
+/*******************************************************************************
+ * PRIVATE FUNCTIONS                                                           *
+ ******************************************************************************/
+
+/*
+ * Counts the raw low samples of every latched bumper pin, starting over when
+ * the pin is newly latched or reads high, and re-arms the edge path once a pin
+ * has been low for BUMPER_RELEASE samples.
+ */
+static void bumperRearm(uint16_t sample)
+{
+    uint16_t latched = bumperEdgeLatched() >> IN_BUMPER_SH;
+    uint16_t release = 0;
+    uint8_t i;
+
+    for (i = 0; i < NUM_BUMPERS; i++)
+    {
+        if (!(latched & (1 << i)))
+        {
+            continue;
+        }
+        if (!(bumperLatchSeen & (1 << i)) || (sample & (1 << i)))
+        {
+            bumperLowRun[i] = 0;
+        }
+        if (!(sample & (1 << i)) && ++bumperLowRun[i] >= BUMPER_RELEASE)
+        {
+            release |= 1 << i;
+        }
+    }
+    if (release)
+    {
+        bumperEdgeRelease(release << IN_BUMPER_SH);
+        latched &= ~release;
+    }
+    bumperLatchSeen = latched;
+}
+
+/*
+ * The lobe is centred halfway between the headings at its two edges. The pose
+ * heading is from the last pose step, up to a pose tick away from the edge the
+ * ISR stamped, so each heading is moved to its edge time at the rate the robot
+ * turned across the lobe.
+ */
+static void beaconEdge(uint8_t seen, uint32_t edgeTime)
+{
+    Pose_t pose;
+    int32_t sweep;
+    int32_t shift;
+    int32_t correction = 0;
+
+    poseGet(&pose);
+    if (seen)
+    {
+        beaconRisen = TRUE;
+        beaconRiseHeading = pose.heading;
+        beaconRisePoseTime = pose.time;
+        beaconRiseEdgeTime = edgeTime;
+        beaconLobeValid = FALSE;
+        return;
+    }
+    if (!beaconRisen)
+    {
+        return;
+    }
+    beaconRisen = FALSE;
+
+    sweep = (int16_t)(pose.heading - beaconRiseHeading);
+    if (pose.time != beaconRisePoseTime)
+    {
+        shift = (int32_t)(edgeTime - pose.time) + (int32_t)(beaconRiseEdgeTime - beaconRisePoseTime);
+        correction = (sweep * shift) / ((int32_t)(pose.time - beaconRisePoseTime) * 2);
+    }
+    beaconLobeHeading = beaconRiseHeading + sweep / 2 + correction;
+    beaconLobeValid = TRUE;
+    #ifdef DEBUG
+    printf("\r\nBeacon lobe %u wide, centre %u", (uint16_t)sweep, beaconLobeHeading);
+    #endif
+}
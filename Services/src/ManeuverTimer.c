@@ -0,0 +1,130 @@
+/*
+ * File:   ManeuverTimer.c
+ * Author: jdgrant
+ *
+ * Timers for moves that cover a distance by driving for a fixed time, scaled by
+ * the speed the robot is getting now against the speed it had at the start.
+ *
+ */
+
+#include "BOARD.h"
+#include "ES_Configure.h"
+#include "ES_Framework.h"
+#include "motor.h"
+#include "BatteryMonitor.h"
+#include "ManeuverTimer.h"
+#include <stdio.h>
+
+//#define DEBUG
+#define RIGHT 1
+#define LEFT 0
+
+// The model is wheel speed per duty with the battery compensation taken back
+// out, (mm/s) * Q12 / (duty out of 1000). That is what the duty table can't
+// correct for: a sagging pack under load, friction, a motor running warm.
+// IIR filter, filtered += (new - filtered) / 2^FILTER_SHIFT, 160 ms at the pose
+// tick.
+#define FILTER_SHIFT 4
+
+// Only steady straight driving says anything about speed, skip ramps, crawling,
+// a robot pushing against a wall, and spins and arcs that scrub the tyres. The
+// velocity loop is skipped too, motorSettled() says FALSE there.
+#define MIN_SAMPLE_DUTY 200 // both wheels together
+#define MIN_SAMPLE_VELOCITY 50 // mm/s, both wheels together
+#define STRAIGHT_DIV 8 // wheel duties within 1/8 of their sum
+
+// The first half second of steady straight driving is the speed the constants were tuned
+// for
+#define REFERENCE_SAMPLES 50
+
+#define MIN_SCALE (MANEUVER_SCALE_ONE / 2)
+#define MAX_SCALE (MANEUVER_SCALE_ONE * 2)
+
+static uint32_t model = 0; // Q(FILTER_SHIFT)
+static uint32_t reference = 0;
+static uint8_t samples = 0;
+static uint16_t scale = MANEUVER_SCALE_ONE;
+
+void maneuverTimerStart(uint8_t Num, uint32_t NewTime)
+{
+    ES_Timer_InitTimer(Num, (NewTime * scale) >> MANEUVER_SCALE_SHIFT);
+}
+
+uint16_t getManeuverScale()
+{
+    return scale;
+}
+
+void maneuverTimerUpdate()
+{
+    int lr;
+    int32_t wheel;
+    int32_t left;
+    int32_t right;
+    int32_t duty = 0;
+    int32_t velocity = 0;
+    uint32_t sample;
+    uint32_t newScale;
+
+    if (!motorSettled())
+    {
+        return;
+    }
+    left = getWheelDuty(LEFT);
+    right = getWheelDuty(RIGHT);
+    if ((left < 0) != (right < 0))
+    {
+        return;
+    }
+    wheel = (left > right) ? left - right : right - left;
+    duty = (left < 0) ? -(left + right) : left + right;
+    if (wheel * STRAIGHT_DIV > duty)
+    {
+        return;
+    }
+    for (lr = LEFT; lr <= RIGHT; lr++)
+    {
+        wheel = getWheelVelocity(lr);
+        velocity += (wheel < 0) ? -wheel : wheel;
+    }
+    if (duty < MIN_SAMPLE_DUTY || velocity < MIN_SAMPLE_VELOCITY)
+    {
+        return;
+    }
+
+    sample = ((uint32_t)velocity * getBatteryCompensation()) / duty;
+    if (samples == 0)
+    {
+        model = sample << FILTER_SHIFT;
+    }
+    else
+    {
+        model += sample - (model >> FILTER_SHIFT);
+    }
+
+    if (samples < REFERENCE_SAMPLES)
+    {
+        if (++samples == REFERENCE_SAMPLES)
+        {
+            reference = model >> FILTER_SHIFT;
+        }
+        return;
+    }
+
+    newScale = (reference << MANEUVER_SCALE_SHIFT) / ((model >> FILTER_SHIFT) + 1);
+    if (newScale < MIN_SCALE)
+    {
+        newScale = MIN_SCALE;
+    }
+    else if (newScale > MAX_SCALE)
+    {
+        newScale = MAX_SCALE;
+    }
+    #ifdef DEBUG
+    if (newScale != scale)
+    {
+        printf("\r\nManeuver scale %u", newScale);
+    }
+    #endif
+    scale = newScale;
+}
@@ -0,0 +1,227 @@
+/*
+ * File:   MissionMemory.c
+ * Author: jdgrant
+ *
+ * Remembers where the loading tower and both targets were found, as poses from
+ * the PoseEstimator, so later ammo cycles can drive straight back instead of
+ * searching from scratch.
+ *
+ */
+
+#include "BOARD.h"
+#include "ES_Configure.h"
+#include "ES_Framework.h"
+#include "motor.h"
+#include "PoseEstimator.h"
+#include "MissionMemory.h"
+#include <stdio.h>
+
+//#define DEBUG
+
+// A place is only worth remembering, and driving back to, if we know where we
+// are to within about 150 mm
+#define MAX_POSITION_VAR (150 * 150)
+
+// Close enough that the normal search will find it right away
+#define ARRIVE_RADIUS 150
+
+#define APPROACH_SPEED 400 // mm/s
+#define APPROACH_SLOW_GAIN 2 // mm/s per mm to go, slows down on the way in
+#define APPROACH_TURN_GAIN 3 // mrad/s per mrad of heading error
+#define APPROACH_MAX_TURN 3000 // mrad/s
+#define APPROACH_SPIN_ANGLE 8192 // 45 degrees, past this turn in place first
+
+// Give up if we've come this much further than the straight line distance, on
+// top of the 1/8 the travelled distance can read long by
+#define APPROACH_SLACK 500 // mm
+
+// Beacon lobe centres are good to about 3 degrees (brad^2). Closer than
+// BEACON_MIN_DISTANCE the position error swamps that, and a lobe more than
+// BEACON_GATE off the remembered bearing is some other target's beacon.
+#define BEACON_HEADING_VAR (546L * 546L)
+#define BEACON_MIN_DISTANCE 500 // mm
+#define BEACON_GATE 5461 // 30 degrees
+
+typedef struct {
+    int32_t x;
+    int32_t y;
+    uint16_t heading;
+    uint8_t valid;
+} Place_t;
+
+static Place_t places[MISSION_PLACES];
+static uint8_t running = FALSE;
+static uint8_t target = MISSION_TOWER;
+static uint32_t budget = 0;
+static int32_t lastX = 0;
+static int32_t lastY = 0;
+
+static uint8_t poseUsable(const Pose_t *pose);
+static void approachDone(uint8_t result);
+
+void missionRecord(uint8_t place)
+{
+    Pose_t pose;
+
+    poseGet(&pose);
+    if (!poseUsable(&pose))
+    {
+        return;
+    }
+    places[place].x = pose.x;
+    places[place].y = pose.y;
+    places[place].heading = pose.heading;
+    places[place].valid = TRUE;
+    #ifdef DEBUG
+    printf("\r\nRemembered place %d at %ld, %ld", place, pose.x, pose.y);
+    #endif
+}
+
+void missionForget(uint8_t place)
+{
+    places[place].valid = FALSE;
+}
+
+uint8_t missionRemembered(uint8_t place)
+{
+    Pose_t pose;
+
+    poseGet(&pose);
+    return places[place].valid && poseUsable(&pose);
+}
+
+/*
+ * With the place where we left it, the lobe should be right on the bearing the
+ * pose works out for it. Whatever is left over is heading error, plus however
+ * much the position error looks like from this far away.
+ */
+void missionBeaconSighted(uint8_t place, uint16_t *lobeHeading)
+{
+    Pose_t pose;
+    uint32_t distance;
+    int32_t error;
+    uint64_t var;
+    uint16_t before;
+
+    if (!missionRemembered(place))
+    {
+        return;
+    }
+    poseGet(&pose);
+    error = (int16_t)(*lobeHeading - poseBearingTo(places[place].x, places[place].y, &distance));
+    if (distance < BEACON_MIN_DISTANCE || error > BEACON_GATE || error < -BEACON_GATE)
+    {
+        return;
+    }
+    var = BEACON_HEADING_VAR + ((uint64_t)(pose.varX + pose.varY) / 2
+            * POSE_BRAD_PER_RAD * POSE_BRAD_PER_RAD) / ((uint64_t)distance * distance);
+    #ifdef DEBUG
+    printf("\r\nBeacon for place %d is %ld brad off", place, error);
+    #endif
+    before = pose.heading;
+    poseCorrectHeading(pose.heading - error, (var > 0xFFFFFFFFUL) ? 0xFFFFFFFFUL : var);
+    poseGet(&pose);
+    *lobeHeading += (uint16_t)(pose.heading - before);
+}
+
+void missionApproachStart(uint8_t place)
+{
+    Pose_t pose;
+    uint32_t distance;
+
+    target = place;
+    if (!missionRemembered(place))
+    {
+        // lost track of it since the sub HSM was initialized, search instead
+        approachDone(APPROACH_FAILED);
+        return;
+    }
+    poseGet(&pose);
+    poseBearingTo(places[place].x, places[place].y, &distance);
+    budget = distance + distance / 8 + APPROACH_SLACK;
+    lastX = pose.x;
+    lastY = pose.y;
+    running = TRUE;
+}
+
+void missionApproachStop()
+{
+    running = FALSE;
+}
+
+/*
+ * Steer toward the place with a turn rate proportional to the heading error. A
+ * big error turns in place, otherwise the forward speed drops off with the
+ * error and with the distance left so the robot doesn't overshoot.
+ */
+void missionApproachUpdate()
+{
+    Pose_t pose;
+    uint32_t distance;
+    int32_t error;
+    int32_t omega;
+    int32_t v;
+    int32_t dx;
+    int32_t dy;
+    uint32_t step;
+
+    if (!running)
+    {
+        return;
+    }
+
+    poseGet(&pose);
+    error = (int16_t)(poseBearingTo(places[target].x, places[target].y, &distance) - pose.heading);
+    if (distance < ARRIVE_RADIUS)
+    {
+        approachDone(APPROACH_ARRIVED);
+        return;
+    }
+
+    // travelled distance as max + min/2, never more than 12% long
+    dx = (pose.x < lastX) ? lastX - pose.x : pose.x - lastX;
+    dy = (pose.y < lastY) ? lastY - pose.y : pose.y - lastY;
+    step = (dx > dy) ? dx + dy / 2 : dy + dx / 2;
+    lastX = pose.x;
+    lastY = pose.y;
+    if (step >= budget)
+    {
+        approachDone(APPROACH_FAILED);
+        return;
+    }
+    budget -= step;
+
+    omega = (error * 1000 / POSE_BRAD_PER_RAD) * APPROACH_TURN_GAIN;
+    if (omega > APPROACH_MAX_TURN) omega = APPROACH_MAX_TURN;
+    if (omega < -APPROACH_MAX_TURN) omega = -APPROACH_MAX_TURN;
+
+    if (error > APPROACH_SPIN_ANGLE || error < -APPROACH_SPIN_ANGLE)
+    {
+        v = 0;
+    }
+    else
+    {
+        v = ((int32_t)APPROACH_SPEED * poseCos(error)) >> 14;
+        if (v > (int32_t)distance * APPROACH_SLOW_GAIN)
+        {
+            v = distance * APPROACH_SLOW_GAIN;
+        }
+    }
+    setTwist(v, omega);
+}
+
+static uint8_t poseUsable(const Pose_t *pose)
+{
+    return (pose->varX < MAX_POSITION_VAR) && (pose->varY < MAX_POSITION_VAR);
+}
+
+static void approachDone(uint8_t result)
+{
+    ES_Event PostEvent;
+
+    running = FALSE;
+    stopMoving();
+    PostEvent.EventType = APPROACH_DONE;
+    PostEvent.EventParam = result;
+    PostTopLevelHSM(PostEvent);
+}
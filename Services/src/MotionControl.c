@@ -0,0 +1,104 @@
+/*
+ * File:   MotionControl.c
+ * Author: TeamPutterWorth
+ *
+ * This service steps the pose driven motion helpers on every POSE_UPDATED from
+ * the PoseEstimator, so the estimator doesn't have to know who uses the pose.
+ *
+ */
+
+/*******************************************************************************
+ * MODULE #INCLUDE                                                             *
+ ******************************************************************************/
+
+#include "BOARD.h"
+#include "ES_Configure.h"
+#include "ES_Framework.h"
+#include "MotionControl.h"
+#include "MissionMemory.h"
+#include "TurnControl.h"
+#include "ManeuverTimer.h"
+#include "TowerHoming.h"
+#include <stdio.h>
+
+/*******************************************************************************
+ * PRIVATE MODULE VARIABLES                                                    *
+ ******************************************************************************/
+
+static uint8_t MyPriority;
+
+/*******************************************************************************
+ * PUBLIC FUNCTIONS                                                            *
+ ******************************************************************************/
+
+/**
+ * @Function InitMotionControlService(uint8_t Priority)
+ * @param Priority - internal variable to track which event queue to use
+ * @return TRUE or FALSE
+ * @brief This will get called by the framework at the beginning of the code
+ *        execution. It will post an ES_INIT event to the appropriate event
+ *        queue, which will be handled inside RunMotionControlService function.
+ *
+ *        Returns TRUE if successful, FALSE otherwise
+ */
+uint8_t InitMotionControlService(uint8_t Priority) {
+    ES_Event ThisEvent;
+
+    MyPriority = Priority;
+
+    // post the initial transition event
+    ThisEvent.EventType = ES_INIT;
+    if (ES_PostToService(MyPriority, ThisEvent) == TRUE) {
+        return TRUE;
+    } else {
+        return FALSE;
+    }
+}
+
+/**
+ * @Function PostMotionControlService(ES_Event ThisEvent)
+ * @param ThisEvent - the event (type and param) to be posted to queue
+ * @return TRUE or FALSE
+ * @brief This function is a wrapper to the queue posting function, and its name
+ *        will be used inside ES_Configure to point to which queue events should
+ *        be posted to.
+ *
+ *        Returns TRUE if successful, FALSE otherwise
+ */
+uint8_t PostMotionControlService(ES_Event ThisEvent) {
+    return ES_PostToService(MyPriority, ThisEvent);
+}
+
+/**
+ * @Function RunMotionControlService(ES_Event ThisEvent)
+ * @param ThisEvent - the event (type and param) to be responded.
+ * @return Event - return event (type and param), in general should be ES_NO_EVENT
+ * @brief The approach and the turn steer first, the maneuver model samples the
+ *        wheels after them and homing goes last, the same order every step.
+ *
+ *       Returns ES_NO_EVENT if the event have been "consumed."
+ */
+ES_Event RunMotionControlService(ES_Event ThisEvent)
+{
+    ES_Event ReturnEvent;
+    ReturnEvent.EventType = ES_NO_EVENT; // assume no errors
+
+    switch (ThisEvent.EventType)
+    {
+        case ES_INIT:
+            break;
+
+        case POSE_UPDATED:
+            missionApproachUpdate();
+            turnUpdate();
+            maneuverTimerUpdate();
+            towerHomingUpdate();
+            break;
+
+        default:
+            printf("\r\nRecieved Event: %s with Param: 0x%X",
+                    EventNames[ThisEvent.EventType], ThisEvent.EventParam);
+            break;
+    }
+    return ReturnEvent;
+}
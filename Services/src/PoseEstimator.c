@@ -0,0 +1,427 @@
+/*
+ * File:   PoseEstimator.c
+ * Author: TeamPutterWorth
+ *
+ * This service dead reckons the robot's position and heading from the wheel
+ * encoders at a fixed rate, and keeps a rough variance for each so the HSMs can
+ * tell how far to trust it. Landmarks (tape, the loading tower, the beacon)
+ * correct it through the poseCorrect functions.
+ *
+ */
+
+/*******************************************************************************
+ * MODULE #INCLUDE                                                             *
+ ******************************************************************************/
+
+#include "BOARD.h"
+#include "ES_Configure.h"
+#include "ES_Framework.h"
+#include "PoseEstimator.h"
+#include "encoder.h"
+#include <stdio.h>
+
+/*******************************************************************************
+ * MODULE #DEFINES                                                             *
+ ******************************************************************************/
+//#define DEBUG
+#define POSE_TICKS 10 // 10 ticks = 10 ms
+
+// Heading change per count of difference between the wheels, in Q8 brad
+#define HEADING_Q8_PER_COUNT ((ENCODER_UM_PER_COUNT * (int32_t)POSE_BRAD_PER_RAD / WHEEL_BASE_MM) * 256 / 1000)
+
+// Variance growth. Along track error is slip and wheel size, mm^2 per mm driven.
+// Heading error grows with how far we turn (brad^2 per brad) and with distance
+// from the wheels not being quite matched (brad^2 per mm). Across track error
+// comes from the heading variance and is worked out every step.
+#define POS_VAR_PER_MM 1
+#define HEADING_VAR_PER_BRAD 50
+#define HEADING_VAR_PER_MM 10
+
+// Square up corrections need the heading to within 20 degrees (brad^2) to be
+// sure which quarter they snap to, and are gated at 3 sigma
+#define SQUARE_MAX_VAR (3641UL * 3641UL)
+#define SQUARE_GATE_SIGMAS_SQ 9
+
+// Position variances are kept in Q8 so slow growth isn't truncated away
+#define VAR_SHIFT 8
+#define VAR_LIMIT 0x7FFFFFFFUL
+
+// CORDIC gain, magnitudes come out 1.6468 times too big. This is 1/1.6468 in Q16.
+#define CORDIC_ITERATIONS 14
+#define CORDIC_INV_GAIN 39797
+
+/*******************************************************************************
+ * PRIVATE FUNCTION PROTOTYPES                                                 *
+ ******************************************************************************/
+
+static void integrate();
+static void growVar(uint32_t *var, uint64_t growth);
+static int32_t blend(int32_t estimate, int32_t measured, uint32_t *var, uint32_t measVar);
+static uint32_t toVarQ8(uint32_t var);
+
+/*******************************************************************************
+ * PRIVATE MODULE VARIABLES                                                    *
+ ******************************************************************************/
+
+static uint8_t MyPriority;
+static int32_t lastCount[2] = {0, 0};
+
+static int32_t xUm = 0;
+static int32_t yUm = 0;
+static uint32_t headingQ8 = 0; // brad << 8, wraps with the turn
+static uint32_t varX = 0; // mm^2, Q8
+static uint32_t varY = 0; // mm^2, Q8
+static uint32_t varHeading = 0; // brad^2
+static uint32_t poseTime = 0; // ES time (ms) of the last step
+
+// First quarter of a sine wave in Q14, 64 steps
+static const int16_t sineTable[65] = {
+    0, 402, 804, 1205, 1606, 2006, 2404, 2801,
+    3196, 3590, 3981, 4370, 4756, 5139, 5520, 5897,
+    6270, 6639, 7005, 7366, 7723, 8076, 8423, 8765,
+    9102, 9434, 9760, 10080, 10394, 10702, 11003, 11297,
+    11585, 11866, 12140, 12406, 12665, 12916, 13160, 13395,
+    13623, 13842, 14053, 14256, 14449, 14635, 14811, 14978,
+    15137, 15286, 15426, 15557, 15679, 15791, 15893, 15986,
+    16069, 16143, 16207, 16261, 16305, 16340, 16364, 16379,
+    16384,
+};
+
+// atan(2^-i) in brad for the CORDIC
+static const uint16_t cordicAngle[CORDIC_ITERATIONS] = {
+    8192, 4836, 2555, 1297, 651, 326, 163, 81, 41, 20, 10, 5, 3, 1,
+};
+
+/*******************************************************************************
+ * PUBLIC FUNCTIONS                                                            *
+ ******************************************************************************/
+
+void poseGet(Pose_t *pose)
+{
+    pose->x = xUm / 1000;
+    pose->y = yUm / 1000;
+    pose->heading = headingQ8 >> 8;
+    pose->varX = varX >> VAR_SHIFT;
+    pose->varY = varY >> VAR_SHIFT;
+    pose->varHeading = varHeading;
+    pose->time = poseTime;
+}
+
+void poseReset(int32_t x, int32_t y, uint16_t heading)
+{
+    xUm = x * 1000;
+    yUm = y * 1000;
+    headingQ8 = (uint32_t)heading << 8;
+    varX = 0;
+    varY = 0;
+    varHeading = 0;
+    poseTime = ES_Timer_GetTime();
+}
+
+void poseCorrectX(int32_t x, uint32_t var)
+{
+    xUm = blend(xUm, x * 1000, &varX, toVarQ8(var));
+}
+
+void poseCorrectY(int32_t y, uint32_t var)
+{
+    yUm = blend(yUm, y * 1000, &varY, toVarQ8(var));
+}
+
+void poseCorrectHeading(uint16_t heading, uint32_t var)
+{
+    // blend the wrapped difference so 359 and 1 degrees average to 0
+    int32_t current = headingQ8 >> 8;
+    int32_t error = (int16_t)(heading - (uint16_t)current);
+
+    headingQ8 = (uint32_t)blend(current, current + error, &varHeading, var) << 8;
+}
+
+/*
+ * If the line really is square, the robot is off by however far the measured
+ * heading is from the nearest quarter turn. With no heading at all yet any
+ * quarter is as good as another, so the first one fixes the frame.
+ */
+void poseCorrectSquare(uint16_t heading, uint32_t var)
+{
+    uint16_t axis = (uint16_t)(heading + POSE_BRAD_90 / 2) & ~(POSE_BRAD_90 - 1);
+    int32_t error = (int16_t)(axis - heading);
+
+    if (varHeading >= VAR_LIMIT)
+    {
+        poseCorrectHeading((uint16_t)((headingQ8 >> 8) + error), var);
+        return;
+    }
+    if (varHeading > SQUARE_MAX_VAR)
+    {
+        return;
+    }
+    if ((uint64_t)(error * error) > SQUARE_GATE_SIGMAS_SQ * ((uint64_t)varHeading + var))
+    {
+        return;
+    }
+    poseCorrectHeading((uint16_t)((headingQ8 >> 8) + error), var);
+}
+
+int16_t poseSin(uint16_t angle)
+{
+    // 256 steps per turn, linear between table entries
+    uint8_t quadrant = angle >> 14;
+    uint16_t step = (angle >> 8) & 0x3F;
+    int32_t frac = angle & 0xFF;
+    int32_t value;
+
+    if (quadrant & 1)
+    {
+        // falling quarter, read the table backwards
+        value = sineTable[64 - step] - (((sineTable[64 - step] - sineTable[63 - step]) * frac) >> 8);
+    }
+    else
+    {
+        value = sineTable[step] + (((sineTable[step + 1] - sineTable[step]) * frac) >> 8);
+    }
+    return (quadrant & 2) ? -value : value;
+}
+
+int16_t poseCos(uint16_t angle)
+{
+    return poseSin(angle + POSE_BRAD_90);
+}
+
+/*
+ * CORDIC in vectoring mode, the vector is rotated onto the x axis by shifts and
+ * adds and the rotations are summed into the angle.
+ */
+uint16_t poseBearingTo(int32_t x, int32_t y, uint32_t *distance)
+{
+    return poseAtan2(y - yUm / 1000, x - xUm / 1000, distance);
+}
+
+uint16_t poseAtan2(int32_t y, int32_t x, uint32_t *magnitude)
+{
+    int32_t dx = x * 256; // 8 extra bits for the shifts
+    int32_t dy = y * 256;
+    int32_t next;
+    uint16_t angle = 0;
+    int i;
+
+    if (dx < 0)
+    {
+        dx = -dx;
+        dy = -dy;
+        angle = POSE_BRAD_180;
+    }
+    for (i = 0; i < CORDIC_ITERATIONS; i++)
+    {
+        if (dy > 0)
+        {
+            next = dx + (dy >> i);
+            dy -= dx >> i;
+            angle += cordicAngle[i];
+        }
+        else
+        {
+            next = dx - (dy >> i);
+            dy += dx >> i;
+            angle -= cordicAngle[i];
+        }
+        dx = next;
+    }
+    if (magnitude)
+    {
+        *magnitude = ((uint64_t)dx * CORDIC_INV_GAIN) >> (16 + 8);
+    }
+    return angle;
+}
+
+/**
+ * @Function InitPoseEstimatorService(uint8_t Priority)
+ * @param Priority - internal variable to track which event queue to use
+ * @return TRUE or FALSE
+ * @brief This will get called by the framework at the beginning of the code
+ *        execution. It will post an ES_INIT event to the appropriate event
+ *        queue, which will be handled inside RunPoseEstimatorService function.
+ *
+ *        Returns TRUE if successful, FALSE otherwise
+ */
+uint8_t InitPoseEstimatorService(uint8_t Priority) {
+    ES_Event ThisEvent;
+
+    MyPriority = Priority;
+
+    lastCount[ENCODER_LEFT] = encoderGetCount(ENCODER_LEFT);
+    lastCount[ENCODER_RIGHT] = encoderGetCount(ENCODER_RIGHT);
+    // We don't know where we start, the first landmark sets the pose outright
+    poseReset(0, 0, 0);
+    varX = VAR_LIMIT;
+    varY = VAR_LIMIT;
+    varHeading = VAR_LIMIT;
+
+    ES_Timer_InitTimer(POSE_TIMER, POSE_TICKS);
+    // post the initial transition event
+    ThisEvent.EventType = ES_INIT;
+    if (ES_PostToService(MyPriority, ThisEvent) == TRUE) {
+        return TRUE;
+    } else {
+        return FALSE;
+    }
+}
+
+/**
+ * @Function PostPoseEstimatorService(ES_Event ThisEvent)
+ * @param ThisEvent - the event (type and param) to be posted to queue
+ * @return TRUE or FALSE
+ * @brief This function is a wrapper to the queue posting function, and its name
+ *        will be used inside ES_Configure to point to which queue events should
+ *        be posted to.
+ *
+ *        Returns TRUE if successful, FALSE otherwise
+ */
+uint8_t PostPoseEstimatorService(ES_Event ThisEvent) {
+    return ES_PostToService(MyPriority, ThisEvent);
+}
+
+/**
+ * @Function RunPoseEstimatorService(ES_Event ThisEvent)
+ * @param ThisEvent - the event (type and param) to be responded.
+ * @return Event - return event (type and param), in general should be ES_NO_EVENT
+ * @brief Integrates the encoder travel once per POSE_TIMER timeout and posts
+ *        POSE_UPDATED to distribution list 0 for whoever steers off the pose.
+ *
+ *       Returns ES_NO_EVENT if the event have been "consumed."
+ */
+ES_Event RunPoseEstimatorService(ES_Event ThisEvent)
+{
+    ES_Event ReturnEvent;
+    ES_Event PostEvent;
+    ReturnEvent.EventType = ES_NO_EVENT; // assume no errors
+
+    switch (ThisEvent.EventType)
+    {
+        case ES_INIT:
+            break;
+
+        case ES_TIMERACTIVE:
+
+        case ES_TIMERSTOPPED:
+            break;
+
+        case ES_TIMEOUT:
+            if (ThisEvent.EventParam != POSE_TIMER)
+            {
+                break;
+            }
+            ES_Timer_InitTimer(POSE_TIMER, POSE_TICKS);
+            integrate();
+            PostEvent.EventType = POSE_UPDATED;
+            PostEvent.EventParam = 0;
+            ES_PostList00(PostEvent);
+            #ifdef DEBUG
+            printf("\r\nPose: %ld %ld %u", xUm / 1000, yUm / 1000, (uint16_t)(headingQ8 >> 8));
+            #endif
+            break;
+
+        default:
+            printf("\r\nRecieved Event: %s with Param: 0x%X",
+                    EventNames[ThisEvent.EventType], ThisEvent.EventParam);
+            break;
+    }
+    return ReturnEvent;
+}
+
+/*******************************************************************************
+ * PRIVATE FUNCTIONS                                                           *
+ ******************************************************************************/
+
+/*
+ * One dead reckoning step. The robot is moved along the heading halfway through
+ * the step, which is exact for a constant arc.
+ */
+static void integrate()
+{
+    int32_t left = encoderGetCount(ENCODER_LEFT);
+    int32_t right = encoderGetCount(ENCODER_RIGHT);
+    int32_t dLeft = left - lastCount[ENCODER_LEFT];
+    int32_t dRight = right - lastCount[ENCODER_RIGHT];
+    int32_t dsUm;
+    int32_t dHeadingQ8;
+    uint32_t dsAbsUm;
+    uint64_t dsSq;
+    uint32_t dHeadingAbs;
+    uint16_t midHeading;
+    int32_t c;
+    int32_t s;
+    uint64_t along;
+    uint64_t across;
+
+    lastCount[ENCODER_LEFT] = left;
+    lastCount[ENCODER_RIGHT] = right;
+    poseTime = ES_Timer_GetTime();
+    if (dLeft == 0 && dRight == 0)
+    {
+        return;
+    }
+
+    dsUm = ((dLeft + dRight) * ENCODER_UM_PER_COUNT) / 2;
+    dHeadingQ8 = (dRight - dLeft) * HEADING_Q8_PER_COUNT;
+    midHeading = (headingQ8 + dHeadingQ8 / 2) >> 8;
+    c = poseCos(midHeading);
+    s = poseSin(midHeading);
+
+    xUm += (dsUm * c) >> 14;
+    yUm += (dsUm * s) >> 14;
+    headingQ8 += dHeadingQ8;
+
+    // Along and across track growth, rotated onto x and y. The step is squared
+    // in um * mm first, at full speed um^2 times the heading variance would be
+    // past 64 bits.
+    dsAbsUm = (dsUm < 0) ? -dsUm : dsUm;
+    dsSq = ((uint64_t)dsAbsUm * dsAbsUm) / 1000;
+    along = ((uint64_t)POS_VAR_PER_MM * dsAbsUm << VAR_SHIFT) / 1000;
+    across = ((dsSq * varHeading) << VAR_SHIFT)
+            / (1000ULL * POSE_BRAD_PER_RAD * POSE_BRAD_PER_RAD);
+    if (across > VAR_LIMIT)
+    {
+        across = VAR_LIMIT; // keeps the rotation below in 64 bits
+    }
+    growVar(&varX, (along * c * c + across * s * s) >> 28);
+    growVar(&varY, (along * s * s + across * c * c) >> 28);
+
+    dHeadingAbs = (dHeadingQ8 < 0) ? -dHeadingQ8 : dHeadingQ8;
+    growVar(&varHeading, ((uint64_t)HEADING_VAR_PER_BRAD * dHeadingAbs >> 8)
+            + (uint64_t)HEADING_VAR_PER_MM * dsAbsUm / 1000);
+}
+
+static void growVar(uint32_t *var, uint64_t growth)
+{
+    if (growth >= VAR_LIMIT - *var)
+    {
+        *var = VAR_LIMIT;
+    }
+    else
+    {
+        *var += growth;
+    }
+}
+
+/*
+ * Scalar Kalman update, the measurement pulls the estimate in proportion to how
+ * uncertain the estimate is compared to the measurement.
+ */
+static int32_t blend(int32_t estimate, int32_t measured, uint32_t *var, uint32_t measVar)
+{
+    uint64_t total = (uint64_t)*var + measVar;
+
+    if (total == 0)
+    {
+        return measured;
+    }
+    estimate += ((int64_t)(measured - estimate) * *var) / (int64_t)total;
+    *var = ((uint64_t)*var * measVar) / total;
+    return estimate;
+}
+
+static uint32_t toVarQ8(uint32_t var)
+{
+    return (var >= (VAR_LIMIT >> VAR_SHIFT)) ? VAR_LIMIT : (var << VAR_SHIFT);
+}
@@ -0,0 +1,227 @@
+/*
+ * File:   ServoMotion.c
+ * Author: TeamPutterWorth
+ *
+ * This service moves the unloading and bridge servos along timed profiles in
+ * the background and posts SERVO_DONE once a move has slewed and held.
+ *
+ */
+
+/*******************************************************************************
+ * MODULE #INCLUDE                                                             *
+ ******************************************************************************/
+
+#include "BOARD.h"
+#include "ES_Configure.h"
+#include "ES_Framework.h"
+#include "ServoMotion.h"
+#include "sensors.h"
+#include <stdio.h>
+
+/*******************************************************************************
+ * MODULE #DEFINES                                                             *
+ ******************************************************************************/
+//#define DEBUG
+
+/*******************************************************************************
+ * PRIVATE TYPEDEFS                                                            *
+ ******************************************************************************/
+
+typedef struct {
+    uint16_t pulse; // last pulse sent to RC_Servo
+    uint16_t from;
+    uint16_t to;
+    uint32_t start; // ES time (ms) the move started
+    uint16_t slewMs;
+    uint16_t holdMs;
+    uint8_t running;
+} ServoMove_t;
+
+/*******************************************************************************
+ * PRIVATE FUNCTION PROTOTYPES                                                 *
+ ******************************************************************************/
+
+static void setPulse(uint8_t servo, uint16_t pulse);
+static uint8_t stepMove(uint8_t servo, uint32_t now);
+
+/*******************************************************************************
+ * PRIVATE MODULE VARIABLES                                                    *
+ ******************************************************************************/
+
+static uint8_t MyPriority;
+static ServoMove_t moves[NUM_SERVOS];
+
+/*******************************************************************************
+ * PUBLIC FUNCTIONS                                                            *
+ ******************************************************************************/
+
+void servoMotionStart(uint8_t servo, uint16_t pulse, uint16_t slewMs, uint16_t holdMs)
+{
+    moves[servo].from = moves[servo].pulse;
+    moves[servo].to = pulse;
+    moves[servo].start = ES_Timer_GetTime();
+    moves[servo].slewMs = slewMs;
+    moves[servo].holdMs = holdMs;
+    moves[servo].running = TRUE;
+    ES_Timer_InitTimer(SERVO_TIMER, SERVO_TIMER_TICKS);
+}
+
+void servoMotionSet(uint8_t servo, uint16_t pulse)
+{
+    moves[servo].running = FALSE;
+    setPulse(servo, pulse);
+}
+
+uint8_t servoMotionRunning(uint8_t servo)
+{
+    return moves[servo].running;
+}
+
+/**
+ * @Function InitServoMotionService(uint8_t Priority)
+ * @param Priority - internal variable to track which event queue to use
+ * @return TRUE or FALSE
+ * @brief This will get called by the framework at the beginning of the code
+ *        execution. It will post an ES_INIT event to the appropriate event
+ *        queue, which will be handled inside RunServoMotionService function.
+ *
+ *        Returns TRUE if successful, FALSE otherwise
+ */
+uint8_t InitServoMotionService(uint8_t Priority) {
+    ES_Event ThisEvent;
+
+    MyPriority = Priority;
+
+    // Both servos start out parked
+    servoMotionSet(SERVO_UNLOADING, UNLOADING_CENTER_PULSE);
+    servoMotionSet(SERVO_BRIDGE, BRIDGE_IN_PULSE);
+
+    // post the initial transition event
+    ThisEvent.EventType = ES_INIT;
+    if (ES_PostToService(MyPriority, ThisEvent) == TRUE) {
+        return TRUE;
+    } else {
+        return FALSE;
+    }
+}
+
+/**
+ * @Function PostServoMotionService(ES_Event ThisEvent)
+ * @param ThisEvent - the event (type and param) to be posted to queue
+ * @return TRUE or FALSE
+ * @brief This function is a wrapper to the queue posting function, and its name
+ *        will be used inside ES_Configure to point to which queue events should
+ *        be posted to.
+ *
+ *        Returns TRUE if successful, FALSE otherwise
+ */
+uint8_t PostServoMotionService(ES_Event ThisEvent) {
+    return ES_PostToService(MyPriority, ThisEvent);
+}
+
+/**
+ * @Function RunServoMotionService(ES_Event ThisEvent)
+ * @param ThisEvent - the event (type and param) to be responded.
+ * @return Event - return event (type and param), in general should be ES_NO_EVENT
+ * @brief Every running move is stepped to where it should be at the current ES
+ *        time, so a late timeout doesn't stretch the move. Finished moves post
+ *        SERVO_DONE to the TopLevelHSM with the servo as the param.
+ *
+ *       Returns ES_NO_EVENT if the event have been "consumed."
+ */
+ES_Event RunServoMotionService(ES_Event ThisEvent)
+{
+    ES_Event ReturnEvent;
+    ES_Event PostEvent;
+    uint32_t now;
+    uint8_t servo;
+    uint8_t active = FALSE;
+    ReturnEvent.EventType = ES_NO_EVENT; // assume no errors
+
+    switch (ThisEvent.EventType)
+    {
+        case ES_INIT:
+            break;
+
+        case ES_TIMERACTIVE:
+
+        case ES_TIMERSTOPPED:
+            break;
+
+        case ES_TIMEOUT:
+            if (ThisEvent.EventParam != SERVO_TIMER)
+            {
+                break;
+            }
+
+            now = ES_Timer_GetTime();
+            for (servo = 0; servo < NUM_SERVOS; servo++)
+            {
+                if (!moves[servo].running)
+                {
+                    continue;
+                }
+                if (stepMove(servo, now))
+                {
+                    active = TRUE;
+                    continue;
+                }
+                moves[servo].running = FALSE;
+                #ifdef DEBUG
+                printf("\r\nServo %d done at %u", servo, moves[servo].pulse);
+                #endif
+                PostEvent.EventType = SERVO_DONE;
+                PostEvent.EventParam = servo;
+                PostTopLevelHSM(PostEvent);
+            }
+            if (active)
+            {
+                ES_Timer_InitTimer(SERVO_TIMER, SERVO_TIMER_TICKS);
+            }
+            break;
+
+        default:
+            printf("\r\nRecieved Event: %s with Param: 0x%X",
+                    EventNames[ThisEvent.EventType], ThisEvent.EventParam);
+            break;
+    }
+    return ReturnEvent;
+}
+
+/*******************************************************************************
+ * PRIVATE FUNCTIONS                                                           *
+ ******************************************************************************/
+
+static void setPulse(uint8_t servo, uint16_t pulse)
+{
+    if (servo == SERVO_UNLOADING)
+    {
+        setPulseUnloadingServo(pulse);
+    }
+    else
+    {
+        setPulseBridgeServo(pulse);
+    }
+    moves[servo].pulse = pulse;
+}
+
+/*
+ * The pulse is interpolated from the time since the move started, then held at
+ * the target. Returns FALSE once the hold is over.
+ */
+static uint8_t stepMove(uint8_t servo, uint32_t now)
+{
+    ServoMove_t *move = &moves[servo];
+    uint32_t elapsed = now - move->start;
+    int32_t pulse = move->to;
+
+    if (elapsed < move->slewMs)
+    {
+        pulse = move->from + ((int32_t)move->to - move->from) * (int32_t)elapsed / move->slewMs;
+    }
+    if (pulse != move->pulse)
+    {
+        setPulse(servo, pulse);
+    }
+    return (elapsed < (uint32_t)move->slewMs + move->holdMs);
+}
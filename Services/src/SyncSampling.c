@@ -14,6 +14,11 @@
 #include "ES_Framework.h"
 #include "motor.h"
 #include "sensors.h"
+#include "tapeCapture.h"
+#include "TapeFollow.h"
+#include "TurnControl.h"
+#include "PoseEstimator.h"
+#include "encoder.h"
 #include <stdio.h>
 
 /*******************************************************************************
@@ -21,24 +26,38 @@
  ******************************************************************************/
 //#define DEBUG
 //#define MOTOR_TEST 
-#ifdef DEBUG
-#define TIMER_0_TICKS 500 // 2 ticks = 2 ms
-#else
-#define TIMER_0_TICKS 5 // 2 ticks = 2 ms
-#endif
-#define ON 1
 #define HI_THRESHOLD 250
 #define LO_THRESHOLD 100
-#define NUM_LEDS 5
+#define NUM_LEDS TAPE_NUM_SENSORS
 #define LEFT 0
 #define RIGHT 1
 #define FOLLOWING_THRESHOLD 3
+#define FR_INDEX 0
+#define FL_INDEX 1
+#define FM_INDEX 2
+#define BR_INDEX 3
+#define BL_INDEX 4
+#define LINE_MIN_WEIGHT 50 // total front weight below this means no line
+
+// Corner sensor spacing across the robot, centre to centre
+#define FRONT_PAIR_SPACING_MM 150
+#define BACK_PAIR_SPACING_MM 150
+// Corner crossings further apart than this (1 s) are different lines
+#define PAIR_WINDOW_FRAMES (1000000L / TAPE_FRAME_US)
+// Both wheels have to have gone the same way for the angle to mean anything,
+// within a quarter of the travel plus a count or two of encoder slop
+#define CROSSING_SLACK_COUNTS 2
+// The arena tape runs with the walls, a measured line squares the pose heading
+// up to about 4 degrees (brad^2)
+#define TAPE_HEADING_VAR (728L * 728L)
 
 /*******************************************************************************
  * PRIVATE FUNCTION PROTOTYPES                                                 *
  ******************************************************************************/
 /* Prototypes for private functions for this machine. They should be functions
    relevant to the behavior of this state machine */
+static void updateLineOffset(const int16_t *adcDiff);
+static void cornerCrossing(int sensor, uint16_t sequence);
 
 /*******************************************************************************
  * PRIVATE MODULE VARIABLES                                                    *
@@ -47,10 +66,15 @@
 static const char *eventName;
 static ES_Event storedEvent;
 static uint8_t MyPriority;
-static unsigned int adPins[]={AD_PORTV3,AD_PORTV4,AD_PORTV5,AD_PORTV6,AD_PORTV7};
-static uint16_t ledPins[]={PIN4,PIN3,PIN5,PIN7,PIN8};
 static uint16_t ledBanks[]={LED_BANK1,LED_BANK1,LED_BANK2,LED_BANK2,LED_BANK3};
 static uint8_t lastTape = NOT_FOLLOWING;
+static int16_t lineOffset = 0;
+static uint8_t lineDetected = FALSE;
+static uint8_t cornerCrossed[NUM_LEDS];
+static uint16_t cornerSequence[NUM_LEDS];
+static int32_t cornerCount[NUM_LEDS][2]; // left and right encoder counts at the crossing
+static uint8_t approachValid = FALSE;
+static int16_t approachAngle = 0;
 
 /*******************************************************************************
  * PUBLIC FUNCTIONS                                                            *
@@ -71,22 +95,12 @@ uint8_t InitSyncSamplingService(uint8_t Priority) {
 
     MyPriority = Priority;
 
-    // TODO : Move this init stuff to their proper init functions and then call the init
-    // functions in main.
-    
-    IO_PortsSetPortOutputs(PORTZ, PIN3|PIN4|PIN5|PIN7|PIN8);
-    AD_AddPins(AD_PORTV3|AD_PORTV4|AD_PORTV5|AD_PORTV6|AD_PORTV7);
+    // The LEDs, AD pins and the capture timer are set up by tapeCaptureInit() in main.
 #ifdef MOTOR_TEST
     moveForward();
     setMoveSpeed(25);
 #endif 
     // post the initial transition event
-    IO_PortsWritePort(PORTZ,IO_PortsReadPort(PORTZ) | PIN3); // This Sets PIN7 (the LED) high for the first sample
-    IO_PortsWritePort(PORTZ,IO_PortsReadPort(PORTZ) | PIN4); // This Sets PIN7 (the LED) high for the first sample
-    IO_PortsWritePort(PORTZ,IO_PortsReadPort(PORTZ) | PIN5); // This Sets PIN7 (the LED) high for the first sample
-    IO_PortsWritePort(PORTZ,IO_PortsReadPort(PORTZ) | PIN7); // This Sets PIN7 (the LED) high for the first sample
-    IO_PortsWritePort(PORTZ,IO_PortsReadPort(PORTZ) | PIN8); // This Sets PIN7 (the LED) high for the first sample
-    ES_Timer_InitTimer(SYNC_SAMPLE_TIMER, TIMER_0_TICKS);
     ThisEvent.EventType = ES_INIT;
     if (ES_PostToService(MyPriority, ThisEvent) == TRUE) {
         return TRUE;
@@ -115,7 +129,9 @@ uint8_t PostSyncSamplingService(ES_Event ThisEvent) {
  * @return Event - return event (type and param), in general should be ES_NO_EVENT
  * @brief This service is responsible for synchronous sampling of a VISHAY TCRT5000.
  *        A sample is taken while the LED is on and while it is OFF and the difference
- *        is compared to a threshold to see if there was tape. 
+ *        is compared to a threshold to see if there was tape. The samples are taken
+ *        by the Timer5 capture engine, oversampled and averaged down to one
+ *        difference per sensor, this runs once per TAPE_FRAME_READY.
  * 
  *       Returns ES_NO_EVENT if the event have been "consumed." 
  */
@@ -127,8 +143,8 @@ ES_Event RunSyncSamplingService(ES_Event ThisEvent)
     ES_Event ReturnEvent;
     ES_Event PostEvent;
     ReturnEvent.EventType = ES_NO_EVENT; // assume no errors
-    static uint8_t curLEDState = ON; // LED Starts as on (in init function).
-    static int16_t adcValOn[NUM_LEDS], adcValOff[NUM_LEDS], adcDiff[NUM_LEDS];
+    static int16_t adcDiff[NUM_LEDS];
+    TapeFrame_t frame;
     static ES_EventTyp_t lastEvent [NUM_LEDS] = {OFF_TAPE,OFF_TAPE,OFF_TAPE,OFF_TAPE,OFF_TAPE};
     ES_EventTyp_t curEvent [NUM_LEDS];
 
@@ -142,40 +158,20 @@ ES_Event RunSyncSamplingService(ES_Event ThisEvent)
         case ES_TIMERSTOPPED:
             break;
 
-        case ES_TIMEOUT:
-            ES_Timer_InitTimer(SYNC_SAMPLE_TIMER, TIMER_0_TICKS);
-
-            // We always either turn the LED(s) on or off, it is simple!
-            if (curLEDState == ON)
-            {   
-                for(i = 0;i < NUM_LEDS;i++)
-                {
-                    adcValOn[i] = AD_ReadADPin(adPins[i]); // Read the LED while it has been on for 2 ms 
-                    #ifdef DEBUG
-                    //printf("\r\nadcValOn[%d]: %d",i,adcValOn[i]);
-                    #endif
-                    IO_PortsWritePort(PORTZ,IO_PortsReadPort(PORTZ) & ~ledPins[i]); // This Sets PINi (the LED) low  
-                }
-                curLEDState = FALSE;
-            } else {
-                curLEDState = ON;
-                for(i = 0;i < NUM_LEDS;i++)
-                {
-                    adcValOff[i] = AD_ReadADPin(adPins[i]); // Read the LED after it has been off for 2 ms
-                    #ifdef DEBUG
-                    //printf("\r\nadcValOff[%d]: %d",i,adcValOff[i]);
-                    #endif
-                    IO_PortsWritePort(PORTZ,IO_PortsReadPort(PORTZ) | ledPins[i]); // This Sets PINi (the LED) high
-
-                    adcDiff[i] = adcValOn[i] - adcValOff[i];
-                    #ifdef DEBUG
-                    printf("\r\nadcDiff[%d]: %d",i,adcDiff[i]);
-                    #endif
-                    // Do hystersis check
-                    
-                    //curEvent[i] = lastEvent[i];
-                    
-                    if (adcDiff[i] > HI_THRESHOLD) {
+        case TAPE_FRAME_READY:
+            tapeCaptureReadFrame(&frame);
+            for(i = 0;i < NUM_LEDS;i++)
+            {
+                // Decimate the oversampled sums back to single conversion counts
+                adcDiff[i] = ((int16_t)frame.on[i] - (int16_t)frame.off[i]) / TAPE_OVERSAMPLE;
+                #ifdef DEBUG
+                printf("\r\nadcDiff[%d]: %d",i,adcDiff[i]);
+                #endif
+                // Do hystersis check
+                
+                //curEvent[i] = lastEvent[i];
+                
+                if (adcDiff[i] > HI_THRESHOLD) {
 //                        if ((i % 2) == 0)
 //                        {
 //                            LED_SetBank(ledBanks[i],LED_GetBank(ledBanks[i]) | 0x3);
@@ -184,10 +180,10 @@ ES_Event RunSyncSamplingService(ES_Event ThisEvent)
 //                        {
 //                           LED_SetBank(ledBanks[i],LED_GetBank(ledBanks[i]) | 0xC); 
 //                        }
-                        curEvent[i] = OFF_TAPE;
-                    }
-                    else if (adcDiff[i] < LO_THRESHOLD)
-                    {
+                    curEvent[i] = OFF_TAPE;
+                }
+                else if (adcDiff[i] < LO_THRESHOLD)
+                {
 //                        if ((i % 2) == 0)
 //                        {
 //                            LED_SetBank(ledBanks[i],LED_GetBank(ledBanks[i]) & ~0x3);
@@ -196,80 +192,89 @@ ES_Event RunSyncSamplingService(ES_Event ThisEvent)
 //                        {
 //                           LED_SetBank(ledBanks[i],LED_GetBank(ledBanks[i]) & ~0xC); 
 //                        }
-                        curEvent[i] = ON_TAPE;
-                    }
-                    else 
+                    curEvent[i] = ON_TAPE;
+                }
+                else 
+                {
+                    curEvent[i] = lastEvent[i];
+                }
+                
+                // if we get into this condition, a tape sensor was triggered either on or off
+                if (curEvent[i] != lastEvent[i])
+                {
+                    tapeTriggered = TRUE;
+                    if (i == FM_INDEX && curEvent[i] == ON_TAPE)
                     {
-                        curEvent[i] = lastEvent[i];
+                        turnRateCrossing();
                     }
-                    
-                    // if we get into this condition, a tape sensor was triggered either on or off
-                    if (curEvent[i] != lastEvent[i])
+                    else if (i != FM_INDEX && curEvent[i] == ON_TAPE)
                     {
-                        tapeTriggered = TRUE;
+                        cornerCrossing(i, frame.sequence);
                     }
-                    lastEvent[i] = curEvent[i];
                 }
-                // On further thought, we decided posting one event with curLevel of each sensor is a better idea
-                if (tapeTriggered)
-                {   
-                    /*
-                     * This bit mask returned in EventParam is 
-                     * Bit 0 - FR Tape Sensor
-                     * Bit 1 - FL Tape Sensor 
-                     * Bit 2 - FM Tape Sensor
-                     * Bit 3 - BR Tape Sensor
-                     * Bit 4 - BL Tape Sensor
-                     */
-                    PostEvent.EventParam = 0;
-                    PostEvent.EventType = TAPE_TRIGGERED;
-                    for(i = 0;i < NUM_LEDS;i++)
-                    {
-                        if(curEvent[i] == ON_TAPE)
-                        {
-                            PostEvent.EventParam = PostEvent.EventParam | (1 << i);
-                        }
-                        else
-                        {
-                            PostEvent.EventParam = PostEvent.EventParam & ~(1 << i);
-                        }                
-                    }
-                    #ifdef MOTOR_TEST
-                    if (PostEvent.EventParam)
+                lastEvent[i] = curEvent[i];
+            }
+            updateLineOffset(adcDiff);
+            tapeFollowUpdate();
+            // On further thought, we decided posting one event with curLevel of each sensor is a better idea
+            if (tapeTriggered)
+            {   
+                /*
+                 * This bit mask returned in EventParam is 
+                 * Bit 0 - FR Tape Sensor
+                 * Bit 1 - FL Tape Sensor 
+                 * Bit 2 - FM Tape Sensor
+                 * Bit 3 - BR Tape Sensor
+                 * Bit 4 - BL Tape Sensor
+                 */
+                PostEvent.EventParam = 0;
+                PostEvent.EventType = TAPE_TRIGGERED;
+                for(i = 0;i < NUM_LEDS;i++)
+                {
+                    if(curEvent[i] == ON_TAPE)
                     {
-                        stopMoving();
+                        PostEvent.EventParam = PostEvent.EventParam | (1 << i);
                     }
                     else
                     {
-                        setMoveSpeed(25);
-                    }
-                    #endif
-                    PostTopLevelHSM(PostEvent);
-                    if (PostEvent.EventParam & TS_FR)
-                    {
-                        lastTapeCounter[0]++;
-                    } 
-                    if(PostEvent.EventParam & TS_FL)
-                    {      
-                        lastTapeCounter[1]++;
-                    }
-                    
-                    if (lastTapeCounter[0] > FOLLOWING_THRESHOLD)
-                    {
-                        lastTapeCounter[1] = 0;
-                        lastTapeCounter[0] = 0;
-                        lastTape = RIGHT;
-                        LED_SetBank(LED_BANK1,0xC);
-                    }
-                    if (lastTapeCounter[1] > FOLLOWING_THRESHOLD)
-                    {
-                        lastTapeCounter[0] = 0;
-                        lastTapeCounter[1] = 0;
-                        lastTape = LEFT;
-                        LED_SetBank(LED_BANK1,0x3);
-                    }
-                    tapeTriggered = FALSE;      
+                        PostEvent.EventParam = PostEvent.EventParam & ~(1 << i);
+                    }                
+                }
+                #ifdef MOTOR_TEST
+                if (PostEvent.EventParam)
+                {
+                    stopMoving();
+                }
+                else
+                {
+                    setMoveSpeed(25);
+                }
+                #endif
+                PostTopLevelHSM(PostEvent);
+                if (PostEvent.EventParam & TS_FR)
+                {
+                    lastTapeCounter[0]++;
+                } 
+                if(PostEvent.EventParam & TS_FL)
+                {      
+                    lastTapeCounter[1]++;
                 }
+                
+                if (lastTapeCounter[0] > FOLLOWING_THRESHOLD)
+                {
+                    lastTapeCounter[1] = 0;
+                    lastTapeCounter[0] = 0;
+                    lastTape = RIGHT;
+                    LED_SetBank(LED_BANK1,0xC);
+                }
+                if (lastTapeCounter[1] > FOLLOWING_THRESHOLD)
+                {
+                    lastTapeCounter[0] = 0;
+                    lastTapeCounter[1] = 0;
+                    lastTape = LEFT;
+                    LED_SetBank(LED_BANK1,0x3);
+                }
+                tapeTriggered = FALSE;      
             }
             break;
 
@@ -290,4 +295,131 @@ void setLastTape(uint8_t val)
 {
     lastTape = val;
     return;
-}
\ No newline at end of file
+}
+
+int16_t getLineOffset()
+{
+    return lineOffset;
+}
+
+uint8_t getLineDetected()
+{
+    return lineDetected;
+}
+
+uint8_t getTapeApproachAngle(int16_t *degrees)
+{
+    if (!approachValid)
+    {
+        return FALSE;
+    }
+    approachValid = FALSE;
+    *degrees = approachAngle;
+    return TRUE;
+}
+
+/*******************************************************************************
+ * PRIVATE FUNCTIONS                                                           *
+ ******************************************************************************/
+
+/*
+ * Tape pulls the differential down, so each front sensor is weighted by how far
+ * it is below HI_THRESHOLD. FL sits at -1, FM at 0 and FR at +1, the weighted
+ * mean is the line position in sensor spacings.
+ */
+static void updateLineOffset(const int16_t *adcDiff)
+{
+    int32_t wFR = HI_THRESHOLD - adcDiff[FR_INDEX];
+    int32_t wFL = HI_THRESHOLD - adcDiff[FL_INDEX];
+    int32_t wFM = HI_THRESHOLD - adcDiff[FM_INDEX];
+    int32_t total;
+
+    if (wFR < 0) wFR = 0;
+    if (wFL < 0) wFL = 0;
+    if (wFM < 0) wFM = 0;
+    total = wFR + wFL + wFM;
+
+    if (total < LINE_MIN_WEIGHT)
+    {
+        // hold the last offset so a follower can tell which side it fell off
+        lineDetected = FALSE;
+        return;
+    }
+    lineDetected = TRUE;
+    lineOffset = (int16_t)(((wFR - wFL) * LINE_OFFSET_ONE) / total);
+}
+
+/*
+ * A corner going onto tape either starts a pair or finishes the one its partner
+ * started. Between the two the wheels moved travel, taken from the encoder
+ * counts latched at the first crossing, so the line is atan(travel / spacing)
+ * off square. Whichever side hit first is the side the
+ * line is closer on, the robot turns toward it to square up going forward and
+ * away from it going backward.
+ */
+static void cornerCrossing(int sensor, uint16_t sequence)
+{
+    int partner;
+    int32_t left = encoderGetCount(ENCODER_LEFT);
+    int32_t right = encoderGetCount(ENCODER_RIGHT);
+    int32_t sum;
+    int32_t magnitude;
+    int32_t difference;
+    int32_t travel;
+    int32_t spacing;
+    int16_t angle;
+    Pose_t pose;
+
+    switch (sensor)
+    {
+        case FR_INDEX: partner = FL_INDEX; break;
+        case FL_INDEX: partner = FR_INDEX; break;
+        case BR_INDEX: partner = BL_INDEX; break;
+        default: partner = BR_INDEX; break;
+    }
+
+    if (!cornerCrossed[partner]
+            || (uint16_t)(sequence - cornerSequence[partner]) > PAIR_WINDOW_FRAMES)
+    {
+        // first of the pair, anything measured before is for another line
+        cornerCrossed[sensor] = TRUE;
+        cornerSequence[sensor] = sequence;
+        cornerCount[sensor][ENCODER_LEFT] = left;
+        cornerCount[sensor][ENCODER_RIGHT] = right;
+        approachValid = FALSE;
+        return;
+    }
+    cornerCrossed[partner] = FALSE;
+    cornerCrossed[sensor] = FALSE;
+
+    // counts each wheel moved since the partner crossed
+    left -= cornerCount[partner][ENCODER_LEFT];
+    right -= cornerCount[partner][ENCODER_RIGHT];
+    sum = left + right;
+    magnitude = (sum < 0) ? -sum : sum;
+    difference = (left < right) ? right - left : left - right;
+    if (difference > magnitude / 8 + CROSSING_SLACK_COUNTS)
+    {
+        approachValid = FALSE;
+        return;
+    }
+
+    travel = (magnitude * ENCODER_UM_PER_COUNT) / 2000;
+    spacing = (sensor == FR_INDEX || sensor == FL_INDEX) ? FRONT_PAIR_SPACING_MM : BACK_PAIR_SPACING_MM;
+    angle = ((uint32_t)poseAtan2(travel, spacing, NULL) * 360) >> 16;
+
+    // partner hit first
+    if ((partner == FR_INDEX || partner == BR_INDEX) == (sum > 0))
+    {
+        angle = -angle;
+    }
+    approachAngle = angle;
+    approachValid = TRUE;
+
+    // turning by the angle would leave us square to the line
+    poseGet(&pose);
+    poseCorrectSquare(pose.heading + ((int32_t)angle * 65536) / 360, TAPE_HEADING_VAR);
+    #ifdef DEBUG
+    printf("\r\nTape approach %d deg", approachAngle);
+    #endif
+}
@@ -0,0 +1,150 @@
+/*
+ * File:   TapeFollow.c
+ * Author: jdgrant
+ *
+ * Closed loop tape following. SyncSampling calls tapeFollowUpdate() on every
+ * tape frame, while running it steers the wheels differentially from the line
+ * offset with a fixed point PID. If the line is lost and recovery fails it posts
+ * TAPE_LOST to the TopLevelHSM and stops itself.
+ *
+ */
+
+#include "BOARD.h"
+#include "ES_Configure.h"
+#include "ES_Framework.h"
+#include "motor.h"
+#include "SyncSampling.h"
+#include "TapeFollow.h"
+
+//#define DEBUG
+#define LEFT 0
+#define RIGHT 1
+
+// Gains are Q8, correction = (KP*e + KI*(integral/64) + KD*de) / 256 in motor
+// speed units, where e is the line offset error in Q8 sensor spacings.
+#define TF_KP 24
+#define TF_KI 16
+#define TF_KD 400
+#define TF_INTEGRAL_LIMIT (64 * LINE_OFFSET_ONE) // caps the I term at KI speed units
+#define TF_INTEGRAL_SCALE 64
+
+#define TF_BASE_SPEED 30
+#define TF_MAX_CORRECTION TF_BASE_SPEED
+
+// The line has to be seen this many frames in a row before we count as locked
+// on and tell the rest of the robot which side the tape is on.
+#define TF_LOCK_FRAMES 50
+
+// Lost line recovery, we swing hard toward the side the line was last seen on
+// for this many frames (about 300 ms) before giving up.
+#define TF_LOST_FRAMES 250
+#define TF_RECOVERY_CORRECTION 20
+
+static uint8_t running = FALSE;
+static uint8_t tapeSide = RIGHT;
+static int16_t setpoint = 0;
+static int32_t integral = 0;
+static int16_t lastError = 0;
+static uint16_t lockCount = 0;
+static uint16_t lostCount = 0;
+
+static void driveWithCorrection(int16_t correction);
+
+void tapeFollowStart(uint8_t side)
+{
+    tapeSide = side;
+    setpoint = (side == RIGHT) ? (LINE_OFFSET_ONE / 2) : -(LINE_OFFSET_ONE / 2);
+    integral = 0;
+    lastError = getLineOffset() - setpoint;
+    lockCount = 0;
+    lostCount = 0;
+    running = TRUE;
+}
+
+void tapeFollowStop()
+{
+    running = FALSE;
+}
+
+uint8_t tapeFollowRunning()
+{
+    return running;
+}
+
+void tapeFollowUpdate()
+{
+    int16_t error;
+    int32_t correction;
+    ES_Event PostEvent;
+
+    if (!running)
+    {
+        return;
+    }
+
+    if (!getLineDetected())
+    {
+        lockCount = 0;
+        if (++lostCount > TF_LOST_FRAMES)
+        {
+            running = FALSE;
+            PostEvent.EventType = TAPE_LOST;
+            PostEvent.EventParam = tapeSide;
+            PostTopLevelHSM(PostEvent);
+            return;
+        }
+        // getLineOffset() still holds the last position, turn back toward it
+        driveWithCorrection(getLineOffset() > setpoint ?
+                TF_RECOVERY_CORRECTION : -TF_RECOVERY_CORRECTION);
+        return;
+    }
+    lostCount = 0;
+
+    if (lockCount < TF_LOCK_FRAMES && ++lockCount == TF_LOCK_FRAMES)
+    {
+        setLastTape(tapeSide);
+    }
+
+    error = getLineOffset() - setpoint;
+    correction = ((int32_t)TF_KP * error
+            + (int32_t)TF_KI * (integral / TF_INTEGRAL_SCALE)
+            + (int32_t)TF_KD * (error - lastError)) / 256;
+    lastError = error;
+
+    // Only integrate while the output isn't saturated in the same direction
+    if (correction > TF_MAX_CORRECTION)
+    {
+        correction = TF_MAX_CORRECTION;
+        if (error < 0) integral += error;
+    }
+    else if (correction < -TF_MAX_CORRECTION)
+    {
+        correction = -TF_MAX_CORRECTION;
+        if (error > 0) integral += error;
+    }
+    else
+    {
+        integral += error;
+    }
+
+    if (integral > TF_INTEGRAL_LIMIT)
+    {
+        integral = TF_INTEGRAL_LIMIT;
+    }
+    else if (integral < -TF_INTEGRAL_LIMIT)
+    {
+        integral = -TF_INTEGRAL_LIMIT;
+    }
+
+    driveWithCorrection((int16_t)correction);
+}
+
+/*
+ * A positive correction means the line is to the right of where we want it, so
+ * the left wheel speeds up and the right wheel slows down. Near full correction
+ * the fast side is over the top speed, setArcSpeeds() slows both to keep the arc.
+ */
+static void driveWithCorrection(int16_t correction)
+{
+    setArcSpeeds(TF_BASE_SPEED + correction, TF_BASE_SPEED - correction);
+}
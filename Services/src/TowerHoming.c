@@ -0,0 +1,128 @@
+/*
+ * File:   TowerHoming.c
+ * Author: jdgrant
+ *
+ * Backs the robot into the loading tower by following the track wire field.
+ *
+ */
+
+#include "BOARD.h"
+#include "ES_Configure.h"
+#include "ES_Framework.h"
+#include "motor.h"
+#include "InputSampling.h"
+#include "TowerHoming.h"
+#include <stdio.h>
+
+//#define DEBUG
+#define FRONT_TRACK_WIRE 0
+#define BACK_TRACK_WIRE 1
+
+// The strengths are 32 sample windows, a track wire gets a sample every 1 ms,
+// so a window is only 32 ms. The strengths are averaged over every pose tick of
+// the 100 ms between gradient checks, which covers about 130 samples. A detector
+// at the edge of its range fires on about half its samples, that is 2.8 samples
+// of spread in one window, about 1.5 window samples in the average and 2 between
+// two averages, so a drop has to be 6 samples to count.
+#define HOMING_PERIOD 10 // pose ticks
+#define HOMING_DROP 48 // strength, 6 samples of the window
+
+// The weave swaps sides on its own every so often as well, a gradient that is
+// flat or lost in the noise would otherwise leave it turning one way for good
+#define HOMING_WEAVE_PERIODS 4 // of HOMING_PERIOD
+
+// Close in the back detector fires on every sample and the strength has nothing
+// left to climb, from there it is straight back onto the bumper
+#define HOMING_SATURATED (ON_FRACTION_MAX - 8) // within a sample of every one
+
+#define HOMING_SPEED 150 // mm/s backing in
+#define HOMING_MIN_SPEED 60 // mm/s right at the tower
+#define HOMING_WEAVE 800 // mrad/s, the turn that samples the gradient
+#define HOMING_SPIN 1500 // mrad/s, turning the back round to the tower
+
+// The back has to hear the tower at least this much better than the front
+// before we back up instead of spinning, twice the spread between two averages
+// so it doesn't dither between the two
+#define HOMING_MARGIN 32
+
+static uint8_t running = FALSE;
+static uint8_t ticks = 0;
+static int8_t weave = 1; // which way we turn, flips when the back gets weaker
+static uint8_t weavePeriods = 0;
+static uint8_t lastBack = 0;
+static uint16_t frontSum = 0; // strengths added up over the period
+static uint16_t backSum = 0;
+
+void towerHomingStart()
+{
+    ticks = 0; // the first direction waits for a full period of averaging
+    weave = 1;
+    weavePeriods = 0;
+    lastBack = getTrackWireStrength(BACK_TRACK_WIRE);
+    frontSum = 0;
+    backSum = 0;
+    running = TRUE;
+}
+
+void towerHomingStop()
+{
+    if (running)
+    {
+        running = FALSE;
+        stopMoving();
+    }
+}
+
+/*
+ * Weave in backwards and keep turning the way that makes the back detector
+ * stronger. The back slows down as the field gets stronger so the bumper meets
+ * the tower gently, and once the back detector saturates it stops weaving.
+ */
+void towerHomingUpdate()
+{
+    uint8_t front;
+    uint8_t back;
+    int32_t v;
+
+    if (!running)
+    {
+        return;
+    }
+    frontSum += getTrackWireStrength(FRONT_TRACK_WIRE);
+    backSum += getTrackWireStrength(BACK_TRACK_WIRE);
+    if (++ticks < HOMING_PERIOD)
+    {
+        return;
+    }
+    ticks = 0;
+
+    front = frontSum / HOMING_PERIOD;
+    back = backSum / HOMING_PERIOD;
+    frontSum = 0;
+    backSum = 0;
+    if ((int16_t)back < (int16_t)lastBack - HOMING_DROP || ++weavePeriods >= HOMING_WEAVE_PERIODS)
+    {
+        weave = -weave;
+        weavePeriods = 0;
+    }
+    lastBack = back;
+
+    if (back >= HOMING_SATURATED)
+    {
+        // no gradient left to weave on, and the front can't be louder
+        setTwist(-HOMING_MIN_SPEED, 0);
+    }
+    else if ((int16_t)back < (int16_t)front + HOMING_MARGIN)
+    {
+        // the tower is off the front or the side, spin the back round to it
+        setTwist(0, weave * HOMING_SPIN);
+    }
+    else
+    {
+        v = HOMING_SPEED - ((int32_t)(HOMING_SPEED - HOMING_MIN_SPEED) * back) / ON_FRACTION_MAX;
+        setTwist(-v, weave * HOMING_WEAVE);
+    }
+    #ifdef DEBUG
+    printf("\r\nHoming: front %u back %u weave %d", front, back, weave);
+    #endif
+}
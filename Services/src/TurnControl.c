@@ -0,0 +1,250 @@
+/*
+ * File:   TurnControl.c
+ * Author: jdgrant
+ *
+ * Tank turns by angle instead of by time. The turn is steered off the pose
+ * heading and slows down as it gets close so it doesn't overshoot, then posts
+ * TURN_DONE to the TopLevelHSM.
+ *
+ */
+
+#include "BOARD.h"
+#include "ES_Configure.h"
+#include "ES_Framework.h"
+#include "motor.h"
+#include "PoseEstimator.h"
+#include "TurnControl.h"
+#include <stdio.h>
+
+//#define DEBUG
+
+#define TURN_SPEED 25 // same as the old timed turns
+#define TURN_MIN_SPEED 8 // slowest that still turns on carpet
+#define TURN_SLOW_GAIN 1 // speed units per degree left, under TURN_SPEED
+#define TURN_TOLERANCE 182 // 1 degree in brad
+
+// If the heading hasn't moved after this many pose ticks the encoders aren't
+// working, time the rest of the turn instead
+#define TURN_STALL_TICKS 30
+#define TURN_STALL_BRAD 91 // half a degree
+
+#define DEGREES_TO_BRAD(d) (((int32_t)(d) * 65536) / 360)
+
+// Turn rate estimate, filtered += (new - filtered) / 2^RATE_FILTER_SHIFT. A
+// revolution only counts when the one before it agrees to within
+// 1/RATE_GATE_DIV (about 15%), a missed or extra crossing or a second line in
+// view never gives two in a row. The estimate itself only throws out
+// revolutions more than RATE_OUTLIER times off, so a bad nominal still gets
+// corrected, and the first agreeing pair replaces the nominal outright.
+#define RATE_FILTER_SHIFT 2
+#define RATE_GATE_DIV 7
+#define RATE_OUTLIER 2
+
+static uint8_t running = FALSE;
+static uint8_t timed = FALSE;
+static int32_t target = 0; // brad, signed
+static int32_t turned = 0; // brad, signed
+static uint16_t lastHeading = 0;
+static uint16_t ticks = 0;
+static uint32_t startTime = 0;
+static uint32_t duration = 0;
+
+static uint8_t measuring = FALSE;
+static uint8_t crossings = 0;
+static uint8_t seeded = FALSE; // still running on TURN_TICKS_NOMINAL while FALSE
+static uint32_t crossTime[2] = {0, 0}; // two crossings ago, last crossing
+static uint32_t lastRev = 0; // previous revolution that passed the gate, 0 if none
+static uint32_t ticksPerRev = (uint32_t)TURN_TICKS_NOMINAL << RATE_FILTER_SHIFT;
+
+static void turnAtSpeed(int speed);
+static void turnDone();
+static uint8_t rateAgrees(uint32_t rev, uint32_t reference);
+
+void turnByAngle(int16_t degrees)
+{
+    Pose_t pose;
+
+    poseGet(&pose);
+    lastHeading = pose.heading;
+    target = DEGREES_TO_BRAD(degrees);
+    turned = 0;
+    ticks = 0;
+    timed = FALSE;
+    startTime = ES_Timer_GetTime();
+    // The duty table is battery compensated, so the measured rate holds at any
+    // charge
+    duration = ((uint32_t)((degrees < 0) ? -degrees : degrees) * getTurnTicksPerRev()) / 360;
+    running = TRUE;
+    turnAtSpeed(TURN_SPEED);
+}
+
+void turnToHeading(uint16_t heading)
+{
+    Pose_t pose;
+
+    poseGet(&pose);
+    turnByAngle(((int32_t)(int16_t)(heading - pose.heading) * 360) / 65536);
+}
+
+void turnStop()
+{
+    running = FALSE;
+}
+
+uint8_t turnRunning()
+{
+    return running;
+}
+
+void turnUpdate()
+{
+    Pose_t pose;
+    int32_t remaining;
+    int speed;
+
+    if (!running)
+    {
+        return;
+    }
+
+    if (timed)
+    {
+        if (ES_Timer_GetTime() - startTime >= duration)
+        {
+            turnDone();
+        }
+        return;
+    }
+
+    poseGet(&pose);
+    turned += (int16_t)(pose.heading - lastHeading);
+    lastHeading = pose.heading;
+
+    if (++ticks >= TURN_STALL_TICKS && turned < TURN_STALL_BRAD && turned > -TURN_STALL_BRAD)
+    {
+        timed = TRUE;
+        #ifdef DEBUG
+        printf("\r\nTurn: no heading change, timing it");
+        #endif
+        return;
+    }
+
+    remaining = target - turned;
+    if ((target >= 0 && remaining <= TURN_TOLERANCE) || (target < 0 && remaining >= -TURN_TOLERANCE))
+    {
+        turnDone();
+        return;
+    }
+
+    speed = TURN_MIN_SPEED + (((remaining < 0) ? -remaining : remaining) * 360 / 65536) * TURN_SLOW_GAIN;
+    if (speed > TURN_SPEED)
+    {
+        speed = TURN_SPEED;
+    }
+    turnAtSpeed(speed);
+}
+
+void turnRateMeasureStart()
+{
+    crossings = 0;
+    lastRev = 0;
+    measuring = TRUE;
+}
+
+void turnRateMeasureStop()
+{
+    measuring = FALSE;
+}
+
+/*
+ * Crossings only count once the wheels have ramped up to the turn speed. Every
+ * other crossing is the same edge of the line coming round again.
+ */
+void turnRateCrossing()
+{
+    uint32_t now = ES_Timer_GetTime();
+    uint32_t rev;
+    uint32_t estimate;
+
+    if (!measuring)
+    {
+        return;
+    }
+    if (!motorSettled())
+    {
+        crossings = 0;
+        lastRev = 0;
+        return;
+    }
+
+    if (crossings >= 2)
+    {
+        rev = now - crossTime[0];
+        estimate = ticksPerRev >> RATE_FILTER_SHIFT;
+        if (rev < estimate / RATE_OUTLIER || rev > estimate * RATE_OUTLIER)
+        {
+            lastRev = 0;
+        }
+        else
+        {
+            if (lastRev && rateAgrees(rev, lastRev))
+            {
+                // two revolutions in a row agree, one line under the sensor
+                if (!seeded)
+                {
+                    ticksPerRev = rev << RATE_FILTER_SHIFT;
+                    seeded = TRUE;
+                }
+                else
+                {
+                    ticksPerRev += rev - estimate;
+                }
+                #ifdef DEBUG
+                printf("\r\nTurn: %lu ms/rev, estimate %u", rev, getTurnTicksPerRev());
+                #endif
+            }
+            lastRev = rev;
+        }
+    }
+    else
+    {
+        crossings++;
+    }
+    crossTime[0] = crossTime[1];
+    crossTime[1] = now;
+}
+
+uint16_t getTurnTicksPerRev(void)
+{
+    return ticksPerRev >> RATE_FILTER_SHIFT;
+}
+
+static uint8_t rateAgrees(uint32_t rev, uint32_t reference)
+{
+    uint32_t difference = (rev > reference) ? rev - reference : reference - rev;
+
+    return difference <= reference / RATE_GATE_DIV;
+}
+
+static void turnAtSpeed(int speed)
+{
+    if (target >= 0)
+    {
+        setArcSpeeds(-speed, speed);
+    }
+    else
+    {
+        setArcSpeeds(speed, -speed);
+    }
+}
+
+static void turnDone()
+{
+    ES_Event PostEvent;
+
+    running = FALSE;
+    stopMoving();
+    PostEvent.EventType = TURN_DONE;
+    PostEvent.EventParam = 0;
+    PostTopLevelHSM(PostEvent);
+}
@@ -0,0 +1,131 @@
+/*
+ * File:   motorDutyBench.c
+ * Author: jdgrant
+ *
+ * Host benchmark for the motor duty computation. Times the old floating point
+ * path from setMotorSpeed (AD read scaled to whole volts, speed * 9.9 / volts),
+ * the Q12 multiply and the precomputed table in motorDuty.c over the same
+ * random speed and battery sequence, and checks the table against the float
+ * math.
+ *
+ * Build and run from the project root:
+ *   gcc -O2 -IDrivers/inc bench/motorDutyBench.c Drivers/src/motorDuty.c -o motorDutyBench
+ *   ./motorDutyBench
+ *
+ * The host has an FPU, the PIC32MX does not, so the float numbers here are a
+ * lower bound on what the old path costs on the robot.
+ */
+
+#include <stdio.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include <time.h>
+#include "motorDuty.h"
+
+#define NUM_COMMANDS 4096
+#define NUM_PASSES 2000
+#define MAX_VOLTAGE 9.9
+#define NOMINAL_MV 9900
+
+static int speeds[NUM_COMMANDS];
+static uint16_t adReadings[NUM_COMMANDS];
+static uint16_t compensations[NUM_COMMANDS];
+static volatile uint32_t sink;
+
+static double nowNs()
+{
+    struct timespec t;
+    clock_gettime(CLOCK_MONOTONIC, &t);
+    return t.tv_sec * 1e9 + t.tv_nsec;
+}
+
+// Each path is kept out of line like the real setMotorSpeed call, otherwise the
+// compiler vectorizes the loops and the numbers say nothing about one command.
+
+// setMotorSpeed before the battery monitor, minus the PWM write
+static __attribute__((noinline)) uint16_t legacyDuty(int speed, uint16_t adReading)
+{
+    uint16_t batVoltage = (adReading * 33) / 1023;
+    if (speed > 50) speed = 50;
+    else if (speed < 0) speed = 0;
+    speed = speed * 10;
+    speed = speed * MAX_VOLTAGE / batVoltage;
+    return speed;
+}
+
+// Q12 multiply on every command
+static __attribute__((noinline)) uint16_t multiplyDuty(int speed, uint16_t compensation)
+{
+    if (speed > 50) speed = 50;
+    else if (speed < 0) speed = 0;
+    return ((uint32_t)speed * 10 * compensation) >> MOTOR_DUTY_COMP_SHIFT;
+}
+
+int main()
+{
+    int i, pass;
+    uint32_t acc;
+    uint32_t mv;
+    double start, legacyNs, multiplyNs, tableNs;
+    int worst = 0;
+    int legacyWorst = 0;
+
+    srand(118);
+    for (i = 0; i < NUM_COMMANDS; i++)
+    {
+        speeds[i] = rand() % 60 - 5;
+        adReadings[i] = 250 + rand() % 80; // 8.1 V to 10.6 V
+        mv = ((uint32_t)adReadings[i] * 33000) / 1023;
+        compensations[i] = ((uint32_t)NOMINAL_MV << MOTOR_DUTY_COMP_SHIFT) / mv;
+    }
+
+    acc = 0;
+    start = nowNs();
+    for (pass = 0; pass < NUM_PASSES; pass++)
+        for (i = 0; i < NUM_COMMANDS; i++)
+            acc += legacyDuty(speeds[i], adReadings[i]);
+    legacyNs = (nowNs() - start) / ((double)NUM_PASSES * NUM_COMMANDS);
+    sink = acc;
+
+    acc = 0;
+    start = nowNs();
+    for (pass = 0; pass < NUM_PASSES; pass++)
+        for (i = 0; i < NUM_COMMANDS; i++)
+            acc += multiplyDuty(speeds[i], compensations[i]);
+    multiplyNs = (nowNs() - start) / ((double)NUM_PASSES * NUM_COMMANDS);
+    sink = acc;
+
+    // the battery monitor changes the factor at most every 10 ms, so the table
+    // is built once per pass here
+    acc = 0;
+    start = nowNs();
+    for (pass = 0; pass < NUM_PASSES; pass++)
+    {
+        motorDutySetCompensation(compensations[pass % NUM_COMMANDS]);
+        for (i = 0; i < NUM_COMMANDS; i++)
+            acc += motorDutyFromSpeed(speeds[i]);
+    }
+    tableNs = (nowNs() - start) / ((double)NUM_PASSES * NUM_COMMANDS);
+    sink = acc;
+
+    // The table should match exact float math to within a count of rounding
+    for (i = 0; i < NUM_COMMANDS; i++)
+    {
+        int s = speeds[i] > 50 ? 50 : (speeds[i] < 0 ? 0 : speeds[i]);
+        double exact = s * 10.0 * NOMINAL_MV / (((uint32_t)adReadings[i] * 33000) / 1023);
+        int err;
+        motorDutySetCompensation(compensations[i]);
+        err = (int)exact - motorDutyFromSpeed(speeds[i]);
+        if (err < 0) err = -err;
+        if (err > worst) worst = err;
+        err = (int)exact - legacyDuty(speeds[i], adReadings[i]);
+        if (err < 0) err = -err;
+        if (err > legacyWorst) legacyWorst = err;
+    }
+
+    printf("legacy float:  %6.2f ns/command\n", legacyNs);
+    printf("Q12 multiply:  %6.2f ns/command\n", multiplyNs);
+    printf("lookup table:  %6.2f ns/command\n", tableNs);
+    printf("worst error vs exact float: table %d, legacy %d duty counts\n", worst, legacyWorst);
+    return 0;
+}
@@ -9,6 +9,9 @@
 #include "pwm.h"
 #include "motor.h"
 #include "sensors.h"
+#include "tapeCapture.h"
+#include "trackWireCapture.h"
+#include "encoder.h"
 
 //#define JANKY_TEST_HARNESS
 #ifdef JANKY_TEST_HARNESS
@@ -134,8 +137,11 @@ void main(void)
     AD_Init();
     PWM_Init();
     RC_Init();
+    encoderInit();
     motorInit();
     sensorsInit();
+    trackWireCaptureInit();
+    tapeCaptureInit();
     
     setPulseUnloadingServo(UNLOADING_CENTER_PULSE);
     setPulseBridgeServo(BRIDGE_IN_PULSE);
@@ -51,17 +51,17 @@ OBJECTDIR=build/${CND_CONF}/${IMAGE_TYPE}
 DISTDIR=dist/${CND_CONF}/${IMAGE_TYPE}
 
 # Source Files Quoted if spaced
-SOURCEFILES_QUOTED_IF_SPACED=Level1HSM/src/TopLevelHSM.c Level2HSM/src/AmmoSearchSubHSM.c Level2HSM/src/AmmoLoadSubHSM.c Level2HSM/src/FirstTargetSearchSubHSM.c Level2HSM/src/FirstTargetUnloadSubHSM.c Level2HSM/src/SecondTargetSearchSubHSM.c Level2HSM/src/SecondTargetApproachSubHSM.c Level2HSM/src/SecondTargetUnloadSubHSM.c Drivers/src/motor.c Drivers/src/sensors.c C:/CMPE118/src/ES_Timers.c C:/CMPE118/src/ES_TattleTale.c C:/CMPE118/src/pwm.c C:/CMPE118/src/ES_PostList.c C:/CMPE118/src/AD.c C:/CMPE118/src/ES_Framework.c C:/CMPE118/src/IO_Ports.c C:/CMPE118/src/ES_CheckEvents.c C:/CMPE118/src/BOARD.c C:/CMPE118/src/ES_Queue.c C:/CMPE118/src/LED.c C:/CMPE118/src/ES_KeyboardInput.c C:/CMPE118/src/serial.c C:/CMPE118/src/RC_Servo.c EventCheckers/src/EventChecker.c Services/src/SyncSampling.c Services/src/BumperDebounce.c Services/src/TrackWire.c Services/src/BeaconDebounce.c main.c
+SOURCEFILES_QUOTED_IF_SPACED=Level1HSM/src/TopLevelHSM.c Level2HSM/src/AmmoSearchSubHSM.c Level2HSM/src/AmmoLoadSubHSM.c Level2HSM/src/FirstTargetSearchSubHSM.c Level2HSM/src/FirstTargetUnloadSubHSM.c Level2HSM/src/SecondTargetSearchSubHSM.c Level2HSM/src/SecondTargetApproachSubHSM.c Level2HSM/src/SecondTargetUnloadSubHSM.c Drivers/src/motor.c Drivers/src/sensors.c C:/CMPE118/src/ES_Timers.c C:/CMPE118/src/ES_TattleTale.c C:/CMPE118/src/pwm.c C:/CMPE118/src/ES_PostList.c C:/CMPE118/src/AD.c C:/CMPE118/src/ES_Framework.c C:/CMPE118/src/IO_Ports.c C:/CMPE118/src/ES_CheckEvents.c C:/CMPE118/src/BOARD.c C:/CMPE118/src/ES_Queue.c C:/CMPE118/src/LED.c C:/CMPE118/src/ES_KeyboardInput.c C:/CMPE118/src/serial.c C:/CMPE118/src/RC_Servo.c EventCheckers/src/EventChecker.c Services/src/SyncSampling.c Drivers/src/tapeCapture.c Services/src/TapeFollow.c Services/src/InputSampling.c Drivers/src/debounce.c Services/src/BatteryMonitor.c Drivers/src/motorDuty.c Drivers/src/encoder.c Services/src/PoseEstimator.c Services/src/MissionMemory.c Services/src/TurnControl.c Services/src/ManeuverTimer.c Services/src/TowerHoming.c Drivers/src/trackWireCapture.c Services/src/ServoMotion.c Services/src/MotionControl.c main.c
 
 # Object Files Quoted if spaced
-OBJECTFILES_QUOTED_IF_SPACED=${OBJECTDIR}/Level1HSM/src/TopLevelHSM.o ${OBJECTDIR}/Level2HSM/src/AmmoSearchSubHSM.o ${OBJECTDIR}/Level2HSM/src/AmmoLoadSubHSM.o ${OBJECTDIR}/Level2HSM/src/FirstTargetSearchSubHSM.o ${OBJECTDIR}/Level2HSM/src/FirstTargetUnloadSubHSM.o ${OBJECTDIR}/Level2HSM/src/SecondTargetSearchSubHSM.o ${OBJECTDIR}/Level2HSM/src/SecondTargetApproachSubHSM.o ${OBJECTDIR}/Level2HSM/src/SecondTargetUnloadSubHSM.o ${OBJECTDIR}/Drivers/src/motor.o ${OBJECTDIR}/Drivers/src/sensors.o ${OBJECTDIR}/_ext/331920610/ES_Timers.o ${OBJECTDIR}/_ext/331920610/ES_TattleTale.o ${OBJECTDIR}/_ext/331920610/pwm.o ${OBJECTDIR}/_ext/331920610/ES_PostList.o ${OBJECTDIR}/_ext/331920610/AD.o ${OBJECTDIR}/_ext/331920610/ES_Framework.o ${OBJECTDIR}/_ext/331920610/IO_Ports.o ${OBJECTDIR}/_ext/331920610/ES_CheckEvents.o ${OBJECTDIR}/_ext/331920610/BOARD.o ${OBJECTDIR}/_ext/331920610/ES_Queue.o ${OBJECTDIR}/_ext/331920610/LED.o ${OBJECTDIR}/_ext/331920610/ES_KeyboardInput.o ${OBJECTDIR}/_ext/331920610/serial.o ${OBJECTDIR}/_ext/331920610/RC_Servo.o ${OBJECTDIR}/EventCheckers/src/EventChecker.o ${OBJECTDIR}/Services/src/SyncSampling.o ${OBJECTDIR}/Services/src/BumperDebounce.o ${OBJECTDIR}/Services/src/TrackWire.o ${OBJECTDIR}/Services/src/BeaconDebounce.o ${OBJECTDIR}/main.o
-POSSIBLE_DEPFILES=${OBJECTDIR}/Level1HSM/src/TopLevelHSM.o.d ${OBJECTDIR}/Level2HSM/src/AmmoSearchSubHSM.o.d ${OBJECTDIR}/Level2HSM/src/AmmoLoadSubHSM.o.d ${OBJECTDIR}/Level2HSM/src/FirstTargetSearchSubHSM.o.d ${OBJECTDIR}/Level2HSM/src/FirstTargetUnloadSubHSM.o.d ${OBJECTDIR}/Level2HSM/src/SecondTargetSearchSubHSM.o.d ${OBJECTDIR}/Level2HSM/src/SecondTargetApproachSubHSM.o.d ${OBJECTDIR}/Level2HSM/src/SecondTargetUnloadSubHSM.o.d ${OBJECTDIR}/Drivers/src/motor.o.d ${OBJECTDIR}/Drivers/src/sensors.o.d ${OBJECTDIR}/_ext/331920610/ES_Timers.o.d ${OBJECTDIR}/_ext/331920610/ES_TattleTale.o.d ${OBJECTDIR}/_ext/331920610/pwm.o.d ${OBJECTDIR}/_ext/331920610/ES_PostList.o.d ${OBJECTDIR}/_ext/331920610/AD.o.d ${OBJECTDIR}/_ext/331920610/ES_Framework.o.d ${OBJECTDIR}/_ext/331920610/IO_Ports.o.d ${OBJECTDIR}/_ext/331920610/ES_CheckEvents.o.d ${OBJECTDIR}/_ext/331920610/BOARD.o.d ${OBJECTDIR}/_ext/331920610/ES_Queue.o.d ${OBJECTDIR}/_ext/331920610/LED.o.d ${OBJECTDIR}/_ext/331920610/ES_KeyboardInput.o.d ${OBJECTDIR}/_ext/331920610/serial.o.d ${OBJECTDIR}/_ext/331920610/RC_Servo.o.d ${OBJECTDIR}/EventCheckers/src/EventChecker.o.d ${OBJECTDIR}/Services/src/SyncSampling.o.d ${OBJECTDIR}/Services/src/BumperDebounce.o.d ${OBJECTDIR}/Services/src/TrackWire.o.d ${OBJECTDIR}/Services/src/BeaconDebounce.o.d ${OBJECTDIR}/main.o.d
+OBJECTFILES_QUOTED_IF_SPACED=${OBJECTDIR}/Level1HSM/src/TopLevelHSM.o ${OBJECTDIR}/Level2HSM/src/AmmoSearchSubHSM.o ${OBJECTDIR}/Level2HSM/src/AmmoLoadSubHSM.o ${OBJECTDIR}/Level2HSM/src/FirstTargetSearchSubHSM.o ${OBJECTDIR}/Level2HSM/src/FirstTargetUnloadSubHSM.o ${OBJECTDIR}/Level2HSM/src/SecondTargetSearchSubHSM.o ${OBJECTDIR}/Level2HSM/src/SecondTargetApproachSubHSM.o ${OBJECTDIR}/Level2HSM/src/SecondTargetUnloadSubHSM.o ${OBJECTDIR}/Drivers/src/motor.o ${OBJECTDIR}/Drivers/src/sensors.o ${OBJECTDIR}/_ext/331920610/ES_Timers.o ${OBJECTDIR}/_ext/331920610/ES_TattleTale.o ${OBJECTDIR}/_ext/331920610/pwm.o ${OBJECTDIR}/_ext/331920610/ES_PostList.o ${OBJECTDIR}/_ext/331920610/AD.o ${OBJECTDIR}/_ext/331920610/ES_Framework.o ${OBJECTDIR}/_ext/331920610/IO_Ports.o ${OBJECTDIR}/_ext/331920610/ES_CheckEvents.o ${OBJECTDIR}/_ext/331920610/BOARD.o ${OBJECTDIR}/_ext/331920610/ES_Queue.o ${OBJECTDIR}/_ext/331920610/LED.o ${OBJECTDIR}/_ext/331920610/ES_KeyboardInput.o ${OBJECTDIR}/_ext/331920610/serial.o ${OBJECTDIR}/_ext/331920610/RC_Servo.o ${OBJECTDIR}/EventCheckers/src/EventChecker.o ${OBJECTDIR}/Services/src/SyncSampling.o ${OBJECTDIR}/Drivers/src/tapeCapture.o ${OBJECTDIR}/Services/src/TapeFollow.o ${OBJECTDIR}/Services/src/InputSampling.o ${OBJECTDIR}/Drivers/src/debounce.o ${OBJECTDIR}/Services/src/BatteryMonitor.o ${OBJECTDIR}/Drivers/src/motorDuty.o ${OBJECTDIR}/Drivers/src/encoder.o ${OBJECTDIR}/Services/src/PoseEstimator.o ${OBJECTDIR}/Services/src/MissionMemory.o ${OBJECTDIR}/Services/src/TurnControl.o ${OBJECTDIR}/Services/src/ManeuverTimer.o ${OBJECTDIR}/Services/src/TowerHoming.o ${OBJECTDIR}/Drivers/src/trackWireCapture.o ${OBJECTDIR}/Services/src/ServoMotion.o ${OBJECTDIR}/Services/src/MotionControl.o ${OBJECTDIR}/main.o
+POSSIBLE_DEPFILES=${OBJECTDIR}/Level1HSM/src/TopLevelHSM.o.d ${OBJECTDIR}/Level2HSM/src/AmmoSearchSubHSM.o.d ${OBJECTDIR}/Level2HSM/src/AmmoLoadSubHSM.o.d ${OBJECTDIR}/Level2HSM/src/FirstTargetSearchSubHSM.o.d ${OBJECTDIR}/Level2HSM/src/FirstTargetUnloadSubHSM.o.d ${OBJECTDIR}/Level2HSM/src/SecondTargetSearchSubHSM.o.d ${OBJECTDIR}/Level2HSM/src/SecondTargetApproachSubHSM.o.d ${OBJECTDIR}/Level2HSM/src/SecondTargetUnloadSubHSM.o.d ${OBJECTDIR}/Drivers/src/motor.o.d ${OBJECTDIR}/Drivers/src/sensors.o.d ${OBJECTDIR}/_ext/331920610/ES_Timers.o.d ${OBJECTDIR}/_ext/331920610/ES_TattleTale.o.d ${OBJECTDIR}/_ext/331920610/pwm.o.d ${OBJECTDIR}/_ext/331920610/ES_PostList.o.d ${OBJECTDIR}/_ext/331920610/AD.o.d ${OBJECTDIR}/_ext/331920610/ES_Framework.o.d ${OBJECTDIR}/_ext/331920610/IO_Ports.o.d ${OBJECTDIR}/_ext/331920610/ES_CheckEvents.o.d ${OBJECTDIR}/_ext/331920610/BOARD.o.d ${OBJECTDIR}/_ext/331920610/ES_Queue.o.d ${OBJECTDIR}/_ext/331920610/LED.o.d ${OBJECTDIR}/_ext/331920610/ES_KeyboardInput.o.d ${OBJECTDIR}/_ext/331920610/serial.o.d ${OBJECTDIR}/_ext/331920610/RC_Servo.o.d ${OBJECTDIR}/EventCheckers/src/EventChecker.o.d ${OBJECTDIR}/Services/src/SyncSampling.o.d ${OBJECTDIR}/Drivers/src/tapeCapture.o.d ${OBJECTDIR}/Services/src/TapeFollow.o.d ${OBJECTDIR}/Services/src/InputSampling.o.d ${OBJECTDIR}/Drivers/src/debounce.o.d ${OBJECTDIR}/Services/src/BatteryMonitor.o.d ${OBJECTDIR}/Drivers/src/motorDuty.o.d ${OBJECTDIR}/Drivers/src/encoder.o.d ${OBJECTDIR}/Services/src/PoseEstimator.o.d ${OBJECTDIR}/Services/src/MissionMemory.o.d ${OBJECTDIR}/Services/src/TurnControl.o.d ${OBJECTDIR}/Services/src/ManeuverTimer.o.d ${OBJECTDIR}/Services/src/TowerHoming.o.d ${OBJECTDIR}/Drivers/src/trackWireCapture.o.d ${OBJECTDIR}/Services/src/ServoMotion.o.d ${OBJECTDIR}/Services/src/MotionControl.o.d ${OBJECTDIR}/main.o.d
 
 # Object Files
-OBJECTFILES=${OBJECTDIR}/Level1HSM/src/TopLevelHSM.o ${OBJECTDIR}/Level2HSM/src/AmmoSearchSubHSM.o ${OBJECTDIR}/Level2HSM/src/AmmoLoadSubHSM.o ${OBJECTDIR}/Level2HSM/src/FirstTargetSearchSubHSM.o ${OBJECTDIR}/Level2HSM/src/FirstTargetUnloadSubHSM.o ${OBJECTDIR}/Level2HSM/src/SecondTargetSearchSubHSM.o ${OBJECTDIR}/Level2HSM/src/SecondTargetApproachSubHSM.o ${OBJECTDIR}/Level2HSM/src/SecondTargetUnloadSubHSM.o ${OBJECTDIR}/Drivers/src/motor.o ${OBJECTDIR}/Drivers/src/sensors.o ${OBJECTDIR}/_ext/331920610/ES_Timers.o ${OBJECTDIR}/_ext/331920610/ES_TattleTale.o ${OBJECTDIR}/_ext/331920610/pwm.o ${OBJECTDIR}/_ext/331920610/ES_PostList.o ${OBJECTDIR}/_ext/331920610/AD.o ${OBJECTDIR}/_ext/331920610/ES_Framework.o ${OBJECTDIR}/_ext/331920610/IO_Ports.o ${OBJECTDIR}/_ext/331920610/ES_CheckEvents.o ${OBJECTDIR}/_ext/331920610/BOARD.o ${OBJECTDIR}/_ext/331920610/ES_Queue.o ${OBJECTDIR}/_ext/331920610/LED.o ${OBJECTDIR}/_ext/331920610/ES_KeyboardInput.o ${OBJECTDIR}/_ext/331920610/serial.o ${OBJECTDIR}/_ext/331920610/RC_Servo.o ${OBJECTDIR}/EventCheckers/src/EventChecker.o ${OBJECTDIR}/Services/src/SyncSampling.o ${OBJECTDIR}/Services/src/BumperDebounce.o ${OBJECTDIR}/Services/src/TrackWire.o ${OBJECTDIR}/Services/src/BeaconDebounce.o ${OBJECTDIR}/main.o
+OBJECTFILES=${OBJECTDIR}/Level1HSM/src/TopLevelHSM.o ${OBJECTDIR}/Level2HSM/src/AmmoSearchSubHSM.o ${OBJECTDIR}/Level2HSM/src/AmmoLoadSubHSM.o ${OBJECTDIR}/Level2HSM/src/FirstTargetSearchSubHSM.o ${OBJECTDIR}/Level2HSM/src/FirstTargetUnloadSubHSM.o ${OBJECTDIR}/Level2HSM/src/SecondTargetSearchSubHSM.o ${OBJECTDIR}/Level2HSM/src/SecondTargetApproachSubHSM.o ${OBJECTDIR}/Level2HSM/src/SecondTargetUnloadSubHSM.o ${OBJECTDIR}/Drivers/src/motor.o ${OBJECTDIR}/Drivers/src/sensors.o ${OBJECTDIR}/_ext/331920610/ES_Timers.o ${OBJECTDIR}/_ext/331920610/ES_TattleTale.o ${OBJECTDIR}/_ext/331920610/pwm.o ${OBJECTDIR}/_ext/331920610/ES_PostList.o ${OBJECTDIR}/_ext/331920610/AD.o ${OBJECTDIR}/_ext/331920610/ES_Framework.o ${OBJECTDIR}/_ext/331920610/IO_Ports.o ${OBJECTDIR}/_ext/331920610/ES_CheckEvents.o ${OBJECTDIR}/_ext/331920610/BOARD.o ${OBJECTDIR}/_ext/331920610/ES_Queue.o ${OBJECTDIR}/_ext/331920610/LED.o ${OBJECTDIR}/_ext/331920610/ES_KeyboardInput.o ${OBJECTDIR}/_ext/331920610/serial.o ${OBJECTDIR}/_ext/331920610/RC_Servo.o ${OBJECTDIR}/EventCheckers/src/EventChecker.o ${OBJECTDIR}/Services/src/SyncSampling.o ${OBJECTDIR}/Drivers/src/tapeCapture.o ${OBJECTDIR}/Services/src/TapeFollow.o ${OBJECTDIR}/Services/src/InputSampling.o ${OBJECTDIR}/Drivers/src/debounce.o ${OBJECTDIR}/Services/src/BatteryMonitor.o ${OBJECTDIR}/Drivers/src/motorDuty.o ${OBJECTDIR}/Drivers/src/encoder.o ${OBJECTDIR}/Services/src/PoseEstimator.o ${OBJECTDIR}/Services/src/MissionMemory.o ${OBJECTDIR}/Services/src/TurnControl.o ${OBJECTDIR}/Services/src/ManeuverTimer.o ${OBJECTDIR}/Services/src/TowerHoming.o ${OBJECTDIR}/Drivers/src/trackWireCapture.o ${OBJECTDIR}/Services/src/ServoMotion.o ${OBJECTDIR}/Services/src/MotionControl.o ${OBJECTDIR}/main.o
 
 # Source Files
-SOURCEFILES=Level1HSM/src/TopLevelHSM.c Level2HSM/src/AmmoSearchSubHSM.c Level2HSM/src/AmmoLoadSubHSM.c Level2HSM/src/FirstTargetSearchSubHSM.c Level2HSM/src/FirstTargetUnloadSubHSM.c Level2HSM/src/SecondTargetSearchSubHSM.c Level2HSM/src/SecondTargetApproachSubHSM.c Level2HSM/src/SecondTargetUnloadSubHSM.c Drivers/src/motor.c Drivers/src/sensors.c C:/CMPE118/src/ES_Timers.c C:/CMPE118/src/ES_TattleTale.c C:/CMPE118/src/pwm.c C:/CMPE118/src/ES_PostList.c C:/CMPE118/src/AD.c C:/CMPE118/src/ES_Framework.c C:/CMPE118/src/IO_Ports.c C:/CMPE118/src/ES_CheckEvents.c C:/CMPE118/src/BOARD.c C:/CMPE118/src/ES_Queue.c C:/CMPE118/src/LED.c C:/CMPE118/src/ES_KeyboardInput.c C:/CMPE118/src/serial.c C:/CMPE118/src/RC_Servo.c EventCheckers/src/EventChecker.c Services/src/SyncSampling.c Services/src/BumperDebounce.c Services/src/TrackWire.c Services/src/BeaconDebounce.c main.c
+SOURCEFILES=Level1HSM/src/TopLevelHSM.c Level2HSM/src/AmmoSearchSubHSM.c Level2HSM/src/AmmoLoadSubHSM.c Level2HSM/src/FirstTargetSearchSubHSM.c Level2HSM/src/FirstTargetUnloadSubHSM.c Level2HSM/src/SecondTargetSearchSubHSM.c Level2HSM/src/SecondTargetApproachSubHSM.c Level2HSM/src/SecondTargetUnloadSubHSM.c Drivers/src/motor.c Drivers/src/sensors.c C:/CMPE118/src/ES_Timers.c C:/CMPE118/src/ES_TattleTale.c C:/CMPE118/src/pwm.c C:/CMPE118/src/ES_PostList.c C:/CMPE118/src/AD.c C:/CMPE118/src/ES_Framework.c C:/CMPE118/src/IO_Ports.c C:/CMPE118/src/ES_CheckEvents.c C:/CMPE118/src/BOARD.c C:/CMPE118/src/ES_Queue.c C:/CMPE118/src/LED.c C:/CMPE118/src/ES_KeyboardInput.c C:/CMPE118/src/serial.c C:/CMPE118/src/RC_Servo.c EventCheckers/src/EventChecker.c Services/src/SyncSampling.c Drivers/src/tapeCapture.c Services/src/TapeFollow.c Services/src/InputSampling.c Drivers/src/debounce.c Services/src/BatteryMonitor.c Drivers/src/motorDuty.c Drivers/src/encoder.c Services/src/PoseEstimator.c Services/src/MissionMemory.c Services/src/TurnControl.c Services/src/ManeuverTimer.c Services/src/TowerHoming.c Drivers/src/trackWireCapture.c Services/src/ServoMotion.c Services/src/MotionControl.c main.c
 
 
 CFLAGS=
@@ -173,6 +173,36 @@ ${OBJECTDIR}/Drivers/src/sensors.o: Drivers/src/sensors.c  nbproject/Makefile-${
 	@${RM} ${OBJECTDIR}/Drivers/src/sensors.o 
 	@${FIXDEPS} "${OBJECTDIR}/Drivers/src/sensors.o.d" $(SILENT) -rsi ${MP_CC_DIR}../  -c ${MP_CC}  $(MP_EXTRA_CC_PRE) -g -D__DEBUG -D__MPLAB_DEBUGGER_PK3=1 -fframe-base-loclist  -x c -c -mprocessor=$(MP_PROCESSOR_OPTION)  -I"Drivers/inc" -I"Services/inc" -I"EventCheckers/inc" -I"." -I"Level1HSM/inc" -I"Level2HSM/inc" -I"C:/CMPE118/include" -I"118Project" -MMD -MF "${OBJECTDIR}/Drivers/src/sensors.o.d" -o ${OBJECTDIR}/Drivers/src/sensors.o Drivers/src/sensors.c    -DXPRJ_default=$(CND_CONF)  -legacy-libc  $(COMPARISON_BUILD) 
 	
+${OBJECTDIR}/Drivers/src/trackWireCapture.o: Drivers/src/trackWireCapture.c  nbproject/Makefile-${CND_CONF}.mk
+	@${MKDIR} "${OBJECTDIR}/Drivers/src" 
+	@${RM} ${OBJECTDIR}/Drivers/src/trackWireCapture.o.d 
+	@${RM} ${OBJECTDIR}/Drivers/src/trackWireCapture.o 
+	@${FIXDEPS} "${OBJECTDIR}/Drivers/src/trackWireCapture.o.d" $(SILENT) -rsi ${MP_CC_DIR}../  -c ${MP_CC}  $(MP_EXTRA_CC_PRE) -g -D__DEBUG -D__MPLAB_DEBUGGER_PK3=1 -fframe-base-loclist  -x c -c -mprocessor=$(MP_PROCESSOR_OPTION)  -I"Drivers/inc" -I"Services/inc" -I"EventCheckers/inc" -I"." -I"Level1HSM/inc" -I"Level2HSM/inc" -I"C:/CMPE118/include" -I"118Project" -MMD -MF "${OBJECTDIR}/Drivers/src/trackWireCapture.o.d" -o ${OBJECTDIR}/Drivers/src/trackWireCapture.o Drivers/src/trackWireCapture.c    -DXPRJ_default=$(CND_CONF)  -legacy-libc  $(COMPARISON_BUILD) 
+	
+${OBJECTDIR}/Drivers/src/encoder.o: Drivers/src/encoder.c  nbproject/Makefile-${CND_CONF}.mk
+	@${MKDIR} "${OBJECTDIR}/Drivers/src" 
+	@${RM} ${OBJECTDIR}/Drivers/src/encoder.o.d 
+	@${RM} ${OBJECTDIR}/Drivers/src/encoder.o 
+	@${FIXDEPS} "${OBJECTDIR}/Drivers/src/encoder.o.d" $(SILENT) -rsi ${MP_CC_DIR}../  -c ${MP_CC}  $(MP_EXTRA_CC_PRE) -g -D__DEBUG -D__MPLAB_DEBUGGER_PK3=1 -fframe-base-loclist  -x c -c -mprocessor=$(MP_PROCESSOR_OPTION)  -I"Drivers/inc" -I"Services/inc" -I"EventCheckers/inc" -I"." -I"Level1HSM/inc" -I"Level2HSM/inc" -I"C:/CMPE118/include" -I"118Project" -MMD -MF "${OBJECTDIR}/Drivers/src/encoder.o.d" -o ${OBJECTDIR}/Drivers/src/encoder.o Drivers/src/encoder.c    -DXPRJ_default=$(CND_CONF)  -legacy-libc  $(COMPARISON_BUILD) 
+	
+${OBJECTDIR}/Drivers/src/motorDuty.o: Drivers/src/motorDuty.c  nbproject/Makefile-${CND_CONF}.mk
+	@${MKDIR} "${OBJECTDIR}/Drivers/src" 
+	@${RM} ${OBJECTDIR}/Drivers/src/motorDuty.o.d 
+	@${RM} ${OBJECTDIR}/Drivers/src/motorDuty.o 
+	@${FIXDEPS} "${OBJECTDIR}/Drivers/src/motorDuty.o.d" $(SILENT) -rsi ${MP_CC_DIR}../  -c ${MP_CC}  $(MP_EXTRA_CC_PRE) -g -D__DEBUG -D__MPLAB_DEBUGGER_PK3=1 -fframe-base-loclist  -x c -c -mprocessor=$(MP_PROCESSOR_OPTION)  -I"Drivers/inc" -I"Services/inc" -I"EventCheckers/inc" -I"." -I"Level1HSM/inc" -I"Level2HSM/inc" -I"C:/CMPE118/include" -I"118Project" -MMD -MF "${OBJECTDIR}/Drivers/src/motorDuty.o.d" -o ${OBJECTDIR}/Drivers/src/motorDuty.o Drivers/src/motorDuty.c    -DXPRJ_default=$(CND_CONF)  -legacy-libc  $(COMPARISON_BUILD) 
+	
+${OBJECTDIR}/Drivers/src/debounce.o: Drivers/src/debounce.c  nbproject/Makefile-${CND_CONF}.mk
+	@${MKDIR} "${OBJECTDIR}/Drivers/src" 
+	@${RM} ${OBJECTDIR}/Drivers/src/debounce.o.d 
+	@${RM} ${OBJECTDIR}/Drivers/src/debounce.o 
+	@${FIXDEPS} "${OBJECTDIR}/Drivers/src/debounce.o.d" $(SILENT) -rsi ${MP_CC_DIR}../  -c ${MP_CC}  $(MP_EXTRA_CC_PRE) -g -D__DEBUG -D__MPLAB_DEBUGGER_PK3=1 -fframe-base-loclist  -x c -c -mprocessor=$(MP_PROCESSOR_OPTION)  -I"Drivers/inc" -I"Services/inc" -I"EventCheckers/inc" -I"." -I"Level1HSM/inc" -I"Level2HSM/inc" -I"C:/CMPE118/include" -I"118Project" -MMD -MF "${OBJECTDIR}/Drivers/src/debounce.o.d" -o ${OBJECTDIR}/Drivers/src/debounce.o Drivers/src/debounce.c    -DXPRJ_default=$(CND_CONF)  -legacy-libc  $(COMPARISON_BUILD) 
+	
+${OBJECTDIR}/Drivers/src/tapeCapture.o: Drivers/src/tapeCapture.c  nbproject/Makefile-${CND_CONF}.mk
+	@${MKDIR} "${OBJECTDIR}/Drivers/src" 
+	@${RM} ${OBJECTDIR}/Drivers/src/tapeCapture.o.d 
+	@${RM} ${OBJECTDIR}/Drivers/src/tapeCapture.o 
+	@${FIXDEPS} "${OBJECTDIR}/Drivers/src/tapeCapture.o.d" $(SILENT) -rsi ${MP_CC_DIR}../  -c ${MP_CC}  $(MP_EXTRA_CC_PRE) -g -D__DEBUG -D__MPLAB_DEBUGGER_PK3=1 -fframe-base-loclist  -x c -c -mprocessor=$(MP_PROCESSOR_OPTION)  -I"Drivers/inc" -I"Services/inc" -I"EventCheckers/inc" -I"." -I"Level1HSM/inc" -I"Level2HSM/inc" -I"C:/CMPE118/include" -I"118Project" -MMD -MF "${OBJECTDIR}/Drivers/src/tapeCapture.o.d" -o ${OBJECTDIR}/Drivers/src/tapeCapture.o Drivers/src/tapeCapture.c    -DXPRJ_default=$(CND_CONF)  -legacy-libc  $(COMPARISON_BUILD) 
+	
 ${OBJECTDIR}/_ext/331920610/ES_Timers.o: C:/CMPE118/src/ES_Timers.c  nbproject/Makefile-${CND_CONF}.mk
 	@${MKDIR} "${OBJECTDIR}/_ext/331920610" 
 	@${RM} ${OBJECTDIR}/_ext/331920610/ES_Timers.o.d 
@@ -269,23 +299,65 @@ ${OBJECTDIR}/Services/src/SyncSampling.o: Services/src/SyncSampling.c  nbproject
 	@${RM} ${OBJECTDIR}/Services/src/SyncSampling.o 
 	@${FIXDEPS} "${OBJECTDIR}/Services/src/SyncSampling.o.d" $(SILENT) -rsi ${MP_CC_DIR}../  -c ${MP_CC}  $(MP_EXTRA_CC_PRE) -g -D__DEBUG -D__MPLAB_DEBUGGER_PK3=1 -fframe-base-loclist  -x c -c -mprocessor=$(MP_PROCESSOR_OPTION)  -I"Drivers/inc" -I"Services/inc" -I"EventCheckers/inc" -I"." -I"Level1HSM/inc" -I"Level2HSM/inc" -I"C:/CMPE118/include" -I"118Project" -MMD -MF "${OBJECTDIR}/Services/src/SyncSampling.o.d" -o ${OBJECTDIR}/Services/src/SyncSampling.o Services/src/SyncSampling.c    -DXPRJ_default=$(CND_CONF)  -legacy-libc  $(COMPARISON_BUILD) 
 	
-${OBJECTDIR}/Services/src/BumperDebounce.o: Services/src/BumperDebounce.c  nbproject/Makefile-${CND_CONF}.mk
+${OBJECTDIR}/Services/src/MotionControl.o: Services/src/MotionControl.c  nbproject/Makefile-${CND_CONF}.mk
+	@${MKDIR} "${OBJECTDIR}/Services/src" 
+	@${RM} ${OBJECTDIR}/Services/src/MotionControl.o.d 
+	@${RM} ${OBJECTDIR}/Services/src/MotionControl.o 
+	@${FIXDEPS} "${OBJECTDIR}/Services/src/MotionControl.o.d" $(SILENT) -rsi ${MP_CC_DIR}../  -c ${MP_CC}  $(MP_EXTRA_CC_PRE) -g -D__DEBUG -D__MPLAB_DEBUGGER_PK3=1 -fframe-base-loclist  -x c -c -mprocessor=$(MP_PROCESSOR_OPTION)  -I"Drivers/inc" -I"Services/inc" -I"EventCheckers/inc" -I"." -I"Level1HSM/inc" -I"Level2HSM/inc" -I"C:/CMPE118/include" -I"118Project" -MMD -MF "${OBJECTDIR}/Services/src/MotionControl.o.d" -o ${OBJECTDIR}/Services/src/MotionControl.o Services/src/MotionControl.c    -DXPRJ_default=$(CND_CONF)  -legacy-libc  $(COMPARISON_BUILD) 
+	
+${OBJECTDIR}/Services/src/ServoMotion.o: Services/src/ServoMotion.c  nbproject/Makefile-${CND_CONF}.mk
+	@${MKDIR} "${OBJECTDIR}/Services/src" 
+	@${RM} ${OBJECTDIR}/Services/src/ServoMotion.o.d 
+	@${RM} ${OBJECTDIR}/Services/src/ServoMotion.o 
+	@${FIXDEPS} "${OBJECTDIR}/Services/src/ServoMotion.o.d" $(SILENT) -rsi ${MP_CC_DIR}../  -c ${MP_CC}  $(MP_EXTRA_CC_PRE) -g -D__DEBUG -D__MPLAB_DEBUGGER_PK3=1 -fframe-base-loclist  -x c -c -mprocessor=$(MP_PROCESSOR_OPTION)  -I"Drivers/inc" -I"Services/inc" -I"EventCheckers/inc" -I"." -I"Level1HSM/inc" -I"Level2HSM/inc" -I"C:/CMPE118/include" -I"118Project" -MMD -MF "${OBJECTDIR}/Services/src/ServoMotion.o.d" -o ${OBJECTDIR}/Services/src/ServoMotion.o Services/src/ServoMotion.c    -DXPRJ_default=$(CND_CONF)  -legacy-libc  $(COMPARISON_BUILD) 
+	
+${OBJECTDIR}/Services/src/TowerHoming.o: Services/src/TowerHoming.c  nbproject/Makefile-${CND_CONF}.mk
+	@${MKDIR} "${OBJECTDIR}/Services/src" 
+	@${RM} ${OBJECTDIR}/Services/src/TowerHoming.o.d 
+	@${RM} ${OBJECTDIR}/Services/src/TowerHoming.o 
+	@${FIXDEPS} "${OBJECTDIR}/Services/src/TowerHoming.o.d" $(SILENT) -rsi ${MP_CC_DIR}../  -c ${MP_CC}  $(MP_EXTRA_CC_PRE) -g -D__DEBUG -D__MPLAB_DEBUGGER_PK3=1 -fframe-base-loclist  -x c -c -mprocessor=$(MP_PROCESSOR_OPTION)  -I"Drivers/inc" -I"Services/inc" -I"EventCheckers/inc" -I"." -I"Level1HSM/inc" -I"Level2HSM/inc" -I"C:/CMPE118/include" -I"118Project" -MMD -MF "${OBJECTDIR}/Services/src/TowerHoming.o.d" -o ${OBJECTDIR}/Services/src/TowerHoming.o Services/src/TowerHoming.c    -DXPRJ_default=$(CND_CONF)  -legacy-libc  $(COMPARISON_BUILD) 
+	
+${OBJECTDIR}/Services/src/ManeuverTimer.o: Services/src/ManeuverTimer.c  nbproject/Makefile-${CND_CONF}.mk
+	@${MKDIR} "${OBJECTDIR}/Services/src" 
+	@${RM} ${OBJECTDIR}/Services/src/ManeuverTimer.o.d 
+	@${RM} ${OBJECTDIR}/Services/src/ManeuverTimer.o 
+	@${FIXDEPS} "${OBJECTDIR}/Services/src/ManeuverTimer.o.d" $(SILENT) -rsi ${MP_CC_DIR}../  -c ${MP_CC}  $(MP_EXTRA_CC_PRE) -g -D__DEBUG -D__MPLAB_DEBUGGER_PK3=1 -fframe-base-loclist  -x c -c -mprocessor=$(MP_PROCESSOR_OPTION)  -I"Drivers/inc" -I"Services/inc" -I"EventCheckers/inc" -I"." -I"Level1HSM/inc" -I"Level2HSM/inc" -I"C:/CMPE118/include" -I"118Project" -MMD -MF "${OBJECTDIR}/Services/src/ManeuverTimer.o.d" -o ${OBJECTDIR}/Services/src/ManeuverTimer.o Services/src/ManeuverTimer.c    -DXPRJ_default=$(CND_CONF)  -legacy-libc  $(COMPARISON_BUILD) 
+	
+${OBJECTDIR}/Services/src/TurnControl.o: Services/src/TurnControl.c  nbproject/Makefile-${CND_CONF}.mk
+	@${MKDIR} "${OBJECTDIR}/Services/src" 
+	@${RM} ${OBJECTDIR}/Services/src/TurnControl.o.d 
+	@${RM} ${OBJECTDIR}/Services/src/TurnControl.o 
+	@${FIXDEPS} "${OBJECTDIR}/Services/src/TurnControl.o.d" $(SILENT) -rsi ${MP_CC_DIR}../  -c ${MP_CC}  $(MP_EXTRA_CC_PRE) -g -D__DEBUG -D__MPLAB_DEBUGGER_PK3=1 -fframe-base-loclist  -x c -c -mprocessor=$(MP_PROCESSOR_OPTION)  -I"Drivers/inc" -I"Services/inc" -I"EventCheckers/inc" -I"." -I"Level1HSM/inc" -I"Level2HSM/inc" -I"C:/CMPE118/include" -I"118Project" -MMD -MF "${OBJECTDIR}/Services/src/TurnControl.o.d" -o ${OBJECTDIR}/Services/src/TurnControl.o Services/src/TurnControl.c    -DXPRJ_default=$(CND_CONF)  -legacy-libc  $(COMPARISON_BUILD) 
+	
+${OBJECTDIR}/Services/src/MissionMemory.o: Services/src/MissionMemory.c  nbproject/Makefile-${CND_CONF}.mk
+	@${MKDIR} "${OBJECTDIR}/Services/src" 
+	@${RM} ${OBJECTDIR}/Services/src/MissionMemory.o.d 
+	@${RM} ${OBJECTDIR}/Services/src/MissionMemory.o 
+	@${FIXDEPS} "${OBJECTDIR}/Services/src/MissionMemory.o.d" $(SILENT) -rsi ${MP_CC_DIR}../  -c ${MP_CC}  $(MP_EXTRA_CC_PRE) -g -D__DEBUG -D__MPLAB_DEBUGGER_PK3=1 -fframe-base-loclist  -x c -c -mprocessor=$(MP_PROCESSOR_OPTION)  -I"Drivers/inc" -I"Services/inc" -I"EventCheckers/inc" -I"." -I"Level1HSM/inc" -I"Level2HSM/inc" -I"C:/CMPE118/include" -I"118Project" -MMD -MF "${OBJECTDIR}/Services/src/MissionMemory.o.d" -o ${OBJECTDIR}/Services/src/MissionMemory.o Services/src/MissionMemory.c    -DXPRJ_default=$(CND_CONF)  -legacy-libc  $(COMPARISON_BUILD) 
+	
+${OBJECTDIR}/Services/src/PoseEstimator.o: Services/src/PoseEstimator.c  nbproject/Makefile-${CND_CONF}.mk
+	@${MKDIR} "${OBJECTDIR}/Services/src" 
+	@${RM} ${OBJECTDIR}/Services/src/PoseEstimator.o.d 
+	@${RM} ${OBJECTDIR}/Services/src/PoseEstimator.o 
+	@${FIXDEPS} "${OBJECTDIR}/Services/src/PoseEstimator.o.d" $(SILENT) -rsi ${MP_CC_DIR}../  -c ${MP_CC}  $(MP_EXTRA_CC_PRE) -g -D__DEBUG -D__MPLAB_DEBUGGER_PK3=1 -fframe-base-loclist  -x c -c -mprocessor=$(MP_PROCESSOR_OPTION)  -I"Drivers/inc" -I"Services/inc" -I"EventCheckers/inc" -I"." -I"Level1HSM/inc" -I"Level2HSM/inc" -I"C:/CMPE118/include" -I"118Project" -MMD -MF "${OBJECTDIR}/Services/src/PoseEstimator.o.d" -o ${OBJECTDIR}/Services/src/PoseEstimator.o Services/src/PoseEstimator.c    -DXPRJ_default=$(CND_CONF)  -legacy-libc  $(COMPARISON_BUILD) 
+	
+${OBJECTDIR}/Services/src/BatteryMonitor.o: Services/src/BatteryMonitor.c  nbproject/Makefile-${CND_CONF}.mk
 	@${MKDIR} "${OBJECTDIR}/Services/src" 
-	@${RM} ${OBJECTDIR}/Services/src/BumperDebounce.o.d 
-	@${RM} ${OBJECTDIR}/Services/src/BumperDebounce.o 
-	@${FIXDEPS} "${OBJECTDIR}/Services/src/BumperDebounce.o.d" $(SILENT) -rsi ${MP_CC_DIR}../  -c ${MP_CC}  $(MP_EXTRA_CC_PRE) -g -D__DEBUG -D__MPLAB_DEBUGGER_PK3=1 -fframe-base-loclist  -x c -c -mprocessor=$(MP_PROCESSOR_OPTION)  -I"Drivers/inc" -I"Services/inc" -I"EventCheckers/inc" -I"." -I"Level1HSM/inc" -I"Level2HSM/inc" -I"C:/CMPE118/include" -I"118Project" -MMD -MF "${OBJECTDIR}/Services/src/BumperDebounce.o.d" -o ${OBJECTDIR}/Services/src/BumperDebounce.o Services/src/BumperDebounce.c    -DXPRJ_default=$(CND_CONF)  -legacy-libc  $(COMPARISON_BUILD) 
+	@${RM} ${OBJECTDIR}/Services/src/BatteryMonitor.o.d 
+	@${RM} ${OBJECTDIR}/Services/src/BatteryMonitor.o 
+	@${FIXDEPS} "${OBJECTDIR}/Services/src/BatteryMonitor.o.d" $(SILENT) -rsi ${MP_CC_DIR}../  -c ${MP_CC}  $(MP_EXTRA_CC_PRE) -g -D__DEBUG -D__MPLAB_DEBUGGER_PK3=1 -fframe-base-loclist  -x c -c -mprocessor=$(MP_PROCESSOR_OPTION)  -I"Drivers/inc" -I"Services/inc" -I"EventCheckers/inc" -I"." -I"Level1HSM/inc" -I"Level2HSM/inc" -I"C:/CMPE118/include" -I"118Project" -MMD -MF "${OBJECTDIR}/Services/src/BatteryMonitor.o.d" -o ${OBJECTDIR}/Services/src/BatteryMonitor.o Services/src/BatteryMonitor.c    -DXPRJ_default=$(CND_CONF)  -legacy-libc  $(COMPARISON_BUILD) 
 	
-${OBJECTDIR}/Services/src/TrackWire.o: Services/src/TrackWire.c  nbproject/Makefile-${CND_CONF}.mk
+${OBJECTDIR}/Services/src/InputSampling.o: Services/src/InputSampling.c  nbproject/Makefile-${CND_CONF}.mk
 	@${MKDIR} "${OBJECTDIR}/Services/src" 
-	@${RM} ${OBJECTDIR}/Services/src/TrackWire.o.d 
-	@${RM} ${OBJECTDIR}/Services/src/TrackWire.o 
-	@${FIXDEPS} "${OBJECTDIR}/Services/src/TrackWire.o.d" $(SILENT) -rsi ${MP_CC_DIR}../  -c ${MP_CC}  $(MP_EXTRA_CC_PRE) -g -D__DEBUG -D__MPLAB_DEBUGGER_PK3=1 -fframe-base-loclist  -x c -c -mprocessor=$(MP_PROCESSOR_OPTION)  -I"Drivers/inc" -I"Services/inc" -I"EventCheckers/inc" -I"." -I"Level1HSM/inc" -I"Level2HSM/inc" -I"C:/CMPE118/include" -I"118Project" -MMD -MF "${OBJECTDIR}/Services/src/TrackWire.o.d" -o ${OBJECTDIR}/Services/src/TrackWire.o Services/src/TrackWire.c    -DXPRJ_default=$(CND_CONF)  -legacy-libc  $(COMPARISON_BUILD) 
+	@${RM} ${OBJECTDIR}/Services/src/InputSampling.o.d 
+	@${RM} ${OBJECTDIR}/Services/src/InputSampling.o 
+	@${FIXDEPS} "${OBJECTDIR}/Services/src/InputSampling.o.d" $(SILENT) -rsi ${MP_CC_DIR}../  -c ${MP_CC}  $(MP_EXTRA_CC_PRE) -g -D__DEBUG -D__MPLAB_DEBUGGER_PK3=1 -fframe-base-loclist  -x c -c -mprocessor=$(MP_PROCESSOR_OPTION)  -I"Drivers/inc" -I"Services/inc" -I"EventCheckers/inc" -I"." -I"Level1HSM/inc" -I"Level2HSM/inc" -I"C:/CMPE118/include" -I"118Project" -MMD -MF "${OBJECTDIR}/Services/src/InputSampling.o.d" -o ${OBJECTDIR}/Services/src/InputSampling.o Services/src/InputSampling.c    -DXPRJ_default=$(CND_CONF)  -legacy-libc  $(COMPARISON_BUILD) 
 	
-${OBJECTDIR}/Services/src/BeaconDebounce.o: Services/src/BeaconDebounce.c  nbproject/Makefile-${CND_CONF}.mk
+${OBJECTDIR}/Services/src/TapeFollow.o: Services/src/TapeFollow.c  nbproject/Makefile-${CND_CONF}.mk
 	@${MKDIR} "${OBJECTDIR}/Services/src" 
-	@${RM} ${OBJECTDIR}/Services/src/BeaconDebounce.o.d 
-	@${RM} ${OBJECTDIR}/Services/src/BeaconDebounce.o 
-	@${FIXDEPS} "${OBJECTDIR}/Services/src/BeaconDebounce.o.d" $(SILENT) -rsi ${MP_CC_DIR}../  -c ${MP_CC}  $(MP_EXTRA_CC_PRE) -g -D__DEBUG -D__MPLAB_DEBUGGER_PK3=1 -fframe-base-loclist  -x c -c -mprocessor=$(MP_PROCESSOR_OPTION)  -I"Drivers/inc" -I"Services/inc" -I"EventCheckers/inc" -I"." -I"Level1HSM/inc" -I"Level2HSM/inc" -I"C:/CMPE118/include" -I"118Project" -MMD -MF "${OBJECTDIR}/Services/src/BeaconDebounce.o.d" -o ${OBJECTDIR}/Services/src/BeaconDebounce.o Services/src/BeaconDebounce.c    -DXPRJ_default=$(CND_CONF)  -legacy-libc  $(COMPARISON_BUILD) 
+	@${RM} ${OBJECTDIR}/Services/src/TapeFollow.o.d 
+	@${RM} ${OBJECTDIR}/Services/src/TapeFollow.o 
+	@${FIXDEPS} "${OBJECTDIR}/Services/src/TapeFollow.o.d" $(SILENT) -rsi ${MP_CC_DIR}../  -c ${MP_CC}  $(MP_EXTRA_CC_PRE) -g -D__DEBUG -D__MPLAB_DEBUGGER_PK3=1 -fframe-base-loclist  -x c -c -mprocessor=$(MP_PROCESSOR_OPTION)  -I"Drivers/inc" -I"Services/inc" -I"EventCheckers/inc" -I"." -I"Level1HSM/inc" -I"Level2HSM/inc" -I"C:/CMPE118/include" -I"118Project" -MMD -MF "${OBJECTDIR}/Services/src/TapeFollow.o.d" -o ${OBJECTDIR}/Services/src/TapeFollow.o Services/src/TapeFollow.c    -DXPRJ_default=$(CND_CONF)  -legacy-libc  $(COMPARISON_BUILD) 
 	
 ${OBJECTDIR}/main.o: main.c  nbproject/Makefile-${CND_CONF}.mk
 	@${MKDIR} "${OBJECTDIR}" 
@@ -354,6 +426,36 @@ ${OBJECTDIR}/Drivers/src/sensors.o: Drivers/src/sensors.c  nbproject/Makefile-${
 	@${RM} ${OBJECTDIR}/Drivers/src/sensors.o 
 	@${FIXDEPS} "${OBJECTDIR}/Drivers/src/sensors.o.d" $(SILENT) -rsi ${MP_CC_DIR}../  -c ${MP_CC}  $(MP_EXTRA_CC_PRE)  -g -x c -c -mprocessor=$(MP_PROCESSOR_OPTION)  -I"Drivers/inc" -I"Services/inc" -I"EventCheckers/inc" -I"." -I"Level1HSM/inc" -I"Level2HSM/inc" -I"C:/CMPE118/include" -I"118Project" -MMD -MF "${OBJECTDIR}/Drivers/src/sensors.o.d" -o ${OBJECTDIR}/Drivers/src/sensors.o Drivers/src/sensors.c    -DXPRJ_default=$(CND_CONF)  -legacy-libc  $(COMPARISON_BUILD) 
 	
+${OBJECTDIR}/Drivers/src/trackWireCapture.o: Drivers/src/trackWireCapture.c  nbproject/Makefile-${CND_CONF}.mk
+	@${MKDIR} "${OBJECTDIR}/Drivers/src" 
+	@${RM} ${OBJECTDIR}/Drivers/src/trackWireCapture.o.d 
+	@${RM} ${OBJECTDIR}/Drivers/src/trackWireCapture.o 
+	@${FIXDEPS} "${OBJECTDIR}/Drivers/src/trackWireCapture.o.d" $(SILENT) -rsi ${MP_CC_DIR}../  -c ${MP_CC}  $(MP_EXTRA_CC_PRE)  -g -x c -c -mprocessor=$(MP_PROCESSOR_OPTION)  -I"Drivers/inc" -I"Services/inc" -I"EventCheckers/inc" -I"." -I"Level1HSM/inc" -I"Level2HSM/inc" -I"C:/CMPE118/include" -I"118Project" -MMD -MF "${OBJECTDIR}/Drivers/src/trackWireCapture.o.d" -o ${OBJECTDIR}/Drivers/src/trackWireCapture.o Drivers/src/trackWireCapture.c    -DXPRJ_default=$(CND_CONF)  -legacy-libc  $(COMPARISON_BUILD) 
+	
+${OBJECTDIR}/Drivers/src/encoder.o: Drivers/src/encoder.c  nbproject/Makefile-${CND_CONF}.mk
+	@${MKDIR} "${OBJECTDIR}/Drivers/src" 
+	@${RM} ${OBJECTDIR}/Drivers/src/encoder.o.d 
+	@${RM} ${OBJECTDIR}/Drivers/src/encoder.o 
+	@${FIXDEPS} "${OBJECTDIR}/Drivers/src/encoder.o.d" $(SILENT) -rsi ${MP_CC_DIR}../  -c ${MP_CC}  $(MP_EXTRA_CC_PRE)  -g -x c -c -mprocessor=$(MP_PROCESSOR_OPTION)  -I"Drivers/inc" -I"Services/inc" -I"EventCheckers/inc" -I"." -I"Level1HSM/inc" -I"Level2HSM/inc" -I"C:/CMPE118/include" -I"118Project" -MMD -MF "${OBJECTDIR}/Drivers/src/encoder.o.d" -o ${OBJECTDIR}/Drivers/src/encoder.o Drivers/src/encoder.c    -DXPRJ_default=$(CND_CONF)  -legacy-libc  $(COMPARISON_BUILD) 
+	
+${OBJECTDIR}/Drivers/src/motorDuty.o: Drivers/src/motorDuty.c  nbproject/Makefile-${CND_CONF}.mk
+	@${MKDIR} "${OBJECTDIR}/Drivers/src" 
+	@${RM} ${OBJECTDIR}/Drivers/src/motorDuty.o.d 
+	@${RM} ${OBJECTDIR}/Drivers/src/motorDuty.o 
+	@${FIXDEPS} "${OBJECTDIR}/Drivers/src/motorDuty.o.d" $(SILENT) -rsi ${MP_CC_DIR}../  -c ${MP_CC}  $(MP_EXTRA_CC_PRE)  -g -x c -c -mprocessor=$(MP_PROCESSOR_OPTION)  -I"Drivers/inc" -I"Services/inc" -I"EventCheckers/inc" -I"." -I"Level1HSM/inc" -I"Level2HSM/inc" -I"C:/CMPE118/include" -I"118Project" -MMD -MF "${OBJECTDIR}/Drivers/src/motorDuty.o.d" -o ${OBJECTDIR}/Drivers/src/motorDuty.o Drivers/src/motorDuty.c    -DXPRJ_default=$(CND_CONF)  -legacy-libc  $(COMPARISON_BUILD) 
+	
+${OBJECTDIR}/Drivers/src/debounce.o: Drivers/src/debounce.c  nbproject/Makefile-${CND_CONF}.mk
+	@${MKDIR} "${OBJECTDIR}/Drivers/src" 
+	@${RM} ${OBJECTDIR}/Drivers/src/debounce.o.d 
+	@${RM} ${OBJECTDIR}/Drivers/src/debounce.o 
+	@${FIXDEPS} "${OBJECTDIR}/Drivers/src/debounce.o.d" $(SILENT) -rsi ${MP_CC_DIR}../  -c ${MP_CC}  $(MP_EXTRA_CC_PRE)  -g -x c -c -mprocessor=$(MP_PROCESSOR_OPTION)  -I"Drivers/inc" -I"Services/inc" -I"EventCheckers/inc" -I"." -I"Level1HSM/inc" -I"Level2HSM/inc" -I"C:/CMPE118/include" -I"118Project" -MMD -MF "${OBJECTDIR}/Drivers/src/debounce.o.d" -o ${OBJECTDIR}/Drivers/src/debounce.o Drivers/src/debounce.c    -DXPRJ_default=$(CND_CONF)  -legacy-libc  $(COMPARISON_BUILD) 
+	
+${OBJECTDIR}/Drivers/src/tapeCapture.o: Drivers/src/tapeCapture.c  nbproject/Makefile-${CND_CONF}.mk
+	@${MKDIR} "${OBJECTDIR}/Drivers/src" 
+	@${RM} ${OBJECTDIR}/Drivers/src/tapeCapture.o.d 
+	@${RM} ${OBJECTDIR}/Drivers/src/tapeCapture.o 
+	@${FIXDEPS} "${OBJECTDIR}/Drivers/src/tapeCapture.o.d" $(SILENT) -rsi ${MP_CC_DIR}../  -c ${MP_CC}  $(MP_EXTRA_CC_PRE)  -g -x c -c -mprocessor=$(MP_PROCESSOR_OPTION)  -I"Drivers/inc" -I"Services/inc" -I"EventCheckers/inc" -I"." -I"Level1HSM/inc" -I"Level2HSM/inc" -I"C:/CMPE118/include" -I"118Project" -MMD -MF "${OBJECTDIR}/Drivers/src/tapeCapture.o.d" -o ${OBJECTDIR}/Drivers/src/tapeCapture.o Drivers/src/tapeCapture.c    -DXPRJ_default=$(CND_CONF)  -legacy-libc  $(COMPARISON_BUILD) 
+	
 ${OBJECTDIR}/_ext/331920610/ES_Timers.o: C:/CMPE118/src/ES_Timers.c  nbproject/Makefile-${CND_CONF}.mk
 	@${MKDIR} "${OBJECTDIR}/_ext/331920610" 
 	@${RM} ${OBJECTDIR}/_ext/331920610/ES_Timers.o.d 
@@ -450,23 +552,65 @@ ${OBJECTDIR}/Services/src/SyncSampling.o: Services/src/SyncSampling.c  nbproject
 	@${RM} ${OBJECTDIR}/Services/src/SyncSampling.o 
 	@${FIXDEPS} "${OBJECTDIR}/Services/src/SyncSampling.o.d" $(SILENT) -rsi ${MP_CC_DIR}../  -c ${MP_CC}  $(MP_EXTRA_CC_PRE)  -g -x c -c -mprocessor=$(MP_PROCESSOR_OPTION)  -I"Drivers/inc" -I"Services/inc" -I"EventCheckers/inc" -I"." -I"Level1HSM/inc" -I"Level2HSM/inc" -I"C:/CMPE118/include" -I"118Project" -MMD -MF "${OBJECTDIR}/Services/src/SyncSampling.o.d" -o ${OBJECTDIR}/Services/src/SyncSampling.o Services/src/SyncSampling.c    -DXPRJ_default=$(CND_CONF)  -legacy-libc  $(COMPARISON_BUILD) 
 	
-${OBJECTDIR}/Services/src/BumperDebounce.o: Services/src/BumperDebounce.c  nbproject/Makefile-${CND_CONF}.mk
+${OBJECTDIR}/Services/src/MotionControl.o: Services/src/MotionControl.c  nbproject/Makefile-${CND_CONF}.mk
+	@${MKDIR} "${OBJECTDIR}/Services/src" 
+	@${RM} ${OBJECTDIR}/Services/src/MotionControl.o.d 
+	@${RM} ${OBJECTDIR}/Services/src/MotionControl.o 
+	@${FIXDEPS} "${OBJECTDIR}/Services/src/MotionControl.o.d" $(SILENT) -rsi ${MP_CC_DIR}../  -c ${MP_CC}  $(MP_EXTRA_CC_PRE)  -g -x c -c -mprocessor=$(MP_PROCESSOR_OPTION)  -I"Drivers/inc" -I"Services/inc" -I"EventCheckers/inc" -I"." -I"Level1HSM/inc" -I"Level2HSM/inc" -I"C:/CMPE118/include" -I"118Project" -MMD -MF "${OBJECTDIR}/Services/src/MotionControl.o.d" -o ${OBJECTDIR}/Services/src/MotionControl.o Services/src/MotionControl.c    -DXPRJ_default=$(CND_CONF)  -legacy-libc  $(COMPARISON_BUILD) 
+	
+${OBJECTDIR}/Services/src/ServoMotion.o: Services/src/ServoMotion.c  nbproject/Makefile-${CND_CONF}.mk
+	@${MKDIR} "${OBJECTDIR}/Services/src" 
+	@${RM} ${OBJECTDIR}/Services/src/ServoMotion.o.d 
+	@${RM} ${OBJECTDIR}/Services/src/ServoMotion.o 
+	@${FIXDEPS} "${OBJECTDIR}/Services/src/ServoMotion.o.d" $(SILENT) -rsi ${MP_CC_DIR}../  -c ${MP_CC}  $(MP_EXTRA_CC_PRE)  -g -x c -c -mprocessor=$(MP_PROCESSOR_OPTION)  -I"Drivers/inc" -I"Services/inc" -I"EventCheckers/inc" -I"." -I"Level1HSM/inc" -I"Level2HSM/inc" -I"C:/CMPE118/include" -I"118Project" -MMD -MF "${OBJECTDIR}/Services/src/ServoMotion.o.d" -o ${OBJECTDIR}/Services/src/ServoMotion.o Services/src/ServoMotion.c    -DXPRJ_default=$(CND_CONF)  -legacy-libc  $(COMPARISON_BUILD) 
+	
+${OBJECTDIR}/Services/src/TowerHoming.o: Services/src/TowerHoming.c  nbproject/Makefile-${CND_CONF}.mk
+	@${MKDIR} "${OBJECTDIR}/Services/src" 
+	@${RM} ${OBJECTDIR}/Services/src/TowerHoming.o.d 
+	@${RM} ${OBJECTDIR}/Services/src/TowerHoming.o 
+	@${FIXDEPS} "${OBJECTDIR}/Services/src/TowerHoming.o.d" $(SILENT) -rsi ${MP_CC_DIR}../  -c ${MP_CC}  $(MP_EXTRA_CC_PRE)  -g -x c -c -mprocessor=$(MP_PROCESSOR_OPTION)  -I"Drivers/inc" -I"Services/inc" -I"EventCheckers/inc" -I"." -I"Level1HSM/inc" -I"Level2HSM/inc" -I"C:/CMPE118/include" -I"118Project" -MMD -MF "${OBJECTDIR}/Services/src/TowerHoming.o.d" -o ${OBJECTDIR}/Services/src/TowerHoming.o Services/src/TowerHoming.c    -DXPRJ_default=$(CND_CONF)  -legacy-libc  $(COMPARISON_BUILD) 
+	
+${OBJECTDIR}/Services/src/ManeuverTimer.o: Services/src/ManeuverTimer.c  nbproject/Makefile-${CND_CONF}.mk
+	@${MKDIR} "${OBJECTDIR}/Services/src" 
+	@${RM} ${OBJECTDIR}/Services/src/ManeuverTimer.o.d 
+	@${RM} ${OBJECTDIR}/Services/src/ManeuverTimer.o 
+	@${FIXDEPS} "${OBJECTDIR}/Services/src/ManeuverTimer.o.d" $(SILENT) -rsi ${MP_CC_DIR}../  -c ${MP_CC}  $(MP_EXTRA_CC_PRE)  -g -x c -c -mprocessor=$(MP_PROCESSOR_OPTION)  -I"Drivers/inc" -I"Services/inc" -I"EventCheckers/inc" -I"." -I"Level1HSM/inc" -I"Level2HSM/inc" -I"C:/CMPE118/include" -I"118Project" -MMD -MF "${OBJECTDIR}/Services/src/ManeuverTimer.o.d" -o ${OBJECTDIR}/Services/src/ManeuverTimer.o Services/src/ManeuverTimer.c    -DXPRJ_default=$(CND_CONF)  -legacy-libc  $(COMPARISON_BUILD) 
+	
+${OBJECTDIR}/Services/src/TurnControl.o: Services/src/TurnControl.c  nbproject/Makefile-${CND_CONF}.mk
+	@${MKDIR} "${OBJECTDIR}/Services/src" 
+	@${RM} ${OBJECTDIR}/Services/src/TurnControl.o.d 
+	@${RM} ${OBJECTDIR}/Services/src/TurnControl.o 
+	@${FIXDEPS} "${OBJECTDIR}/Services/src/TurnControl.o.d" $(SILENT) -rsi ${MP_CC_DIR}../  -c ${MP_CC}  $(MP_EXTRA_CC_PRE)  -g -x c -c -mprocessor=$(MP_PROCESSOR_OPTION)  -I"Drivers/inc" -I"Services/inc" -I"EventCheckers/inc" -I"." -I"Level1HSM/inc" -I"Level2HSM/inc" -I"C:/CMPE118/include" -I"118Project" -MMD -MF "${OBJECTDIR}/Services/src/TurnControl.o.d" -o ${OBJECTDIR}/Services/src/TurnControl.o Services/src/TurnControl.c    -DXPRJ_default=$(CND_CONF)  -legacy-libc  $(COMPARISON_BUILD) 
+	
+${OBJECTDIR}/Services/src/MissionMemory.o: Services/src/MissionMemory.c  nbproject/Makefile-${CND_CONF}.mk
+	@${MKDIR} "${OBJECTDIR}/Services/src" 
+	@${RM} ${OBJECTDIR}/Services/src/MissionMemory.o.d 
+	@${RM} ${OBJECTDIR}/Services/src/MissionMemory.o 
+	@${FIXDEPS} "${OBJECTDIR}/Services/src/MissionMemory.o.d" $(SILENT) -rsi ${MP_CC_DIR}../  -c ${MP_CC}  $(MP_EXTRA_CC_PRE)  -g -x c -c -mprocessor=$(MP_PROCESSOR_OPTION)  -I"Drivers/inc" -I"Services/inc" -I"EventCheckers/inc" -I"." -I"Level1HSM/inc" -I"Level2HSM/inc" -I"C:/CMPE118/include" -I"118Project" -MMD -MF "${OBJECTDIR}/Services/src/MissionMemory.o.d" -o ${OBJECTDIR}/Services/src/MissionMemory.o Services/src/MissionMemory.c    -DXPRJ_default=$(CND_CONF)  -legacy-libc  $(COMPARISON_BUILD) 
+	
+${OBJECTDIR}/Services/src/PoseEstimator.o: Services/src/PoseEstimator.c  nbproject/Makefile-${CND_CONF}.mk
+	@${MKDIR} "${OBJECTDIR}/Services/src" 
+	@${RM} ${OBJECTDIR}/Services/src/PoseEstimator.o.d 
+	@${RM} ${OBJECTDIR}/Services/src/PoseEstimator.o 
+	@${FIXDEPS} "${OBJECTDIR}/Services/src/PoseEstimator.o.d" $(SILENT) -rsi ${MP_CC_DIR}../  -c ${MP_CC}  $(MP_EXTRA_CC_PRE)  -g -x c -c -mprocessor=$(MP_PROCESSOR_OPTION)  -I"Drivers/inc" -I"Services/inc" -I"EventCheckers/inc" -I"." -I"Level1HSM/inc" -I"Level2HSM/inc" -I"C:/CMPE118/include" -I"118Project" -MMD -MF "${OBJECTDIR}/Services/src/PoseEstimator.o.d" -o ${OBJECTDIR}/Services/src/PoseEstimator.o Services/src/PoseEstimator.c    -DXPRJ_default=$(CND_CONF)  -legacy-libc  $(COMPARISON_BUILD) 
+	
+${OBJECTDIR}/Services/src/BatteryMonitor.o: Services/src/BatteryMonitor.c  nbproject/Makefile-${CND_CONF}.mk
 	@${MKDIR} "${OBJECTDIR}/Services/src" 
-	@${RM} ${OBJECTDIR}/Services/src/BumperDebounce.o.d 
-	@${RM} ${OBJECTDIR}/Services/src/BumperDebounce.o 
-	@${FIXDEPS} "${OBJECTDIR}/Services/src/BumperDebounce.o.d" $(SILENT) -rsi ${MP_CC_DIR}../  -c ${MP_CC}  $(MP_EXTRA_CC_PRE)  -g -x c -c -mprocessor=$(MP_PROCESSOR_OPTION)  -I"Drivers/inc" -I"Services/inc" -I"EventCheckers/inc" -I"." -I"Level1HSM/inc" -I"Level2HSM/inc" -I"C:/CMPE118/include" -I"118Project" -MMD -MF "${OBJECTDIR}/Services/src/BumperDebounce.o.d" -o ${OBJECTDIR}/Services/src/BumperDebounce.o Services/src/BumperDebounce.c    -DXPRJ_default=$(CND_CONF)  -legacy-libc  $(COMPARISON_BUILD) 
+	@${RM} ${OBJECTDIR}/Services/src/BatteryMonitor.o.d 
+	@${RM} ${OBJECTDIR}/Services/src/BatteryMonitor.o 
+	@${FIXDEPS} "${OBJECTDIR}/Services/src/BatteryMonitor.o.d" $(SILENT) -rsi ${MP_CC_DIR}../  -c ${MP_CC}  $(MP_EXTRA_CC_PRE)  -g -x c -c -mprocessor=$(MP_PROCESSOR_OPTION)  -I"Drivers/inc" -I"Services/inc" -I"EventCheckers/inc" -I"." -I"Level1HSM/inc" -I"Level2HSM/inc" -I"C:/CMPE118/include" -I"118Project" -MMD -MF "${OBJECTDIR}/Services/src/BatteryMonitor.o.d" -o ${OBJECTDIR}/Services/src/BatteryMonitor.o Services/src/BatteryMonitor.c    -DXPRJ_default=$(CND_CONF)  -legacy-libc  $(COMPARISON_BUILD) 
 	
-${OBJECTDIR}/Services/src/TrackWire.o: Services/src/TrackWire.c  nbproject/Makefile-${CND_CONF}.mk
+${OBJECTDIR}/Services/src/InputSampling.o: Services/src/InputSampling.c  nbproject/Makefile-${CND_CONF}.mk
 	@${MKDIR} "${OBJECTDIR}/Services/src" 
-	@${RM} ${OBJECTDIR}/Services/src/TrackWire.o.d 
-	@${RM} ${OBJECTDIR}/Services/src/TrackWire.o 
-	@${FIXDEPS} "${OBJECTDIR}/Services/src/TrackWire.o.d" $(SILENT) -rsi ${MP_CC_DIR}../  -c ${MP_CC}  $(MP_EXTRA_CC_PRE)  -g -x c -c -mprocessor=$(MP_PROCESSOR_OPTION)  -I"Drivers/inc" -I"Services/inc" -I"EventCheckers/inc" -I"." -I"Level1HSM/inc" -I"Level2HSM/inc" -I"C:/CMPE118/include" -I"118Project" -MMD -MF "${OBJECTDIR}/Services/src/TrackWire.o.d" -o ${OBJECTDIR}/Services/src/TrackWire.o Services/src/TrackWire.c    -DXPRJ_default=$(CND_CONF)  -legacy-libc  $(COMPARISON_BUILD) 
+	@${RM} ${OBJECTDIR}/Services/src/InputSampling.o.d 
+	@${RM} ${OBJECTDIR}/Services/src/InputSampling.o 
+	@${FIXDEPS} "${OBJECTDIR}/Services/src/InputSampling.o.d" $(SILENT) -rsi ${MP_CC_DIR}../  -c ${MP_CC}  $(MP_EXTRA_CC_PRE)  -g -x c -c -mprocessor=$(MP_PROCESSOR_OPTION)  -I"Drivers/inc" -I"Services/inc" -I"EventCheckers/inc" -I"." -I"Level1HSM/inc" -I"Level2HSM/inc" -I"C:/CMPE118/include" -I"118Project" -MMD -MF "${OBJECTDIR}/Services/src/InputSampling.o.d" -o ${OBJECTDIR}/Services/src/InputSampling.o Services/src/InputSampling.c    -DXPRJ_default=$(CND_CONF)  -legacy-libc  $(COMPARISON_BUILD) 
 	
-${OBJECTDIR}/Services/src/BeaconDebounce.o: Services/src/BeaconDebounce.c  nbproject/Makefile-${CND_CONF}.mk
+${OBJECTDIR}/Services/src/TapeFollow.o: Services/src/TapeFollow.c  nbproject/Makefile-${CND_CONF}.mk
 	@${MKDIR} "${OBJECTDIR}/Services/src" 
-	@${RM} ${OBJECTDIR}/Services/src/BeaconDebounce.o.d 
-	@${RM} ${OBJECTDIR}/Services/src/BeaconDebounce.o 
-	@${FIXDEPS} "${OBJECTDIR}/Services/src/BeaconDebounce.o.d" $(SILENT) -rsi ${MP_CC_DIR}../  -c ${MP_CC}  $(MP_EXTRA_CC_PRE)  -g -x c -c -mprocessor=$(MP_PROCESSOR_OPTION)  -I"Drivers/inc" -I"Services/inc" -I"EventCheckers/inc" -I"." -I"Level1HSM/inc" -I"Level2HSM/inc" -I"C:/CMPE118/include" -I"118Project" -MMD -MF "${OBJECTDIR}/Services/src/BeaconDebounce.o.d" -o ${OBJECTDIR}/Services/src/BeaconDebounce.o Services/src/BeaconDebounce.c    -DXPRJ_default=$(CND_CONF)  -legacy-libc  $(COMPARISON_BUILD) 
+	@${RM} ${OBJECTDIR}/Services/src/TapeFollow.o.d 
+	@${RM} ${OBJECTDIR}/Services/src/TapeFollow.o 
+	@${FIXDEPS} "${OBJECTDIR}/Services/src/TapeFollow.o.d" $(SILENT) -rsi ${MP_CC_DIR}../  -c ${MP_CC}  $(MP_EXTRA_CC_PRE)  -g -x c -c -mprocessor=$(MP_PROCESSOR_OPTION)  -I"Drivers/inc" -I"Services/inc" -I"EventCheckers/inc" -I"." -I"Level1HSM/inc" -I"Level2HSM/inc" -I"C:/CMPE118/include" -I"118Project" -MMD -MF "${OBJECTDIR}/Services/src/TapeFollow.o.d" -o ${OBJECTDIR}/Services/src/TapeFollow.o Services/src/TapeFollow.c    -DXPRJ_default=$(CND_CONF)  -legacy-libc  $(COMPARISON_BUILD) 
 	
 ${OBJECTDIR}/main.o: main.c  nbproject/Makefile-${CND_CONF}.mk
 	@${MKDIR} "${OBJECTDIR}" 